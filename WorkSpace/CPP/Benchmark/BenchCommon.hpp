@@ -0,0 +1,159 @@
+#ifndef BENCHCOMMON_HPP
+#define BENCHCOMMON_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// 基准测试公共设施：计时、延迟分位数、结果收集与 JSON 输出
+// ============================================================================
+namespace Bench {
+    using Clock = std::chrono::steady_clock;
+
+    inline uint64_t nowNanos() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count());
+    }
+
+    // 阻止编译器把被测代码当作无用计算优化掉
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // 一条测试结果：参数和指标都按插入顺序输出
+    struct Result {
+        std::string suite;
+        std::string name;
+        std::vector<std::pair<std::string, std::string>> params;
+        std::vector<std::pair<std::string, double>> metrics;
+
+        Result& param(const std::string& key, const std::string& value) {
+            params.emplace_back(key, value);
+            return *this;
+        }
+        Result& param(const std::string& key, uint64_t value) {
+            return param(key, std::to_string(value));
+        }
+        Result& metric(const std::string& key, double value) {
+            metrics.emplace_back(key, value);
+            return *this;
+        }
+    };
+
+    // 延迟样本收集器（单位：纳秒）
+    class LatencyRecorder {
+    private:
+        std::vector<uint64_t> samples;
+
+    public:
+        explicit LatencyRecorder(size_t expected = 0) { samples.reserve(expected); }
+
+        void record(uint64_t nanos) { samples.push_back(nanos); }
+        void merge(const LatencyRecorder& other) {
+            samples.insert(samples.end(), other.samples.begin(), other.samples.end());
+        }
+
+        // 写入 p50/p99/p999 指标
+        void report(Result& result) {
+            if (samples.empty()) {
+                return;
+            }
+            std::sort(samples.begin(), samples.end());
+            auto pick = [this](double q) {
+                const auto index = static_cast<size_t>(q * static_cast<double>(samples.size() - 1));
+                return static_cast<double>(samples[index]);
+            };
+            result.metric("p50_ns", pick(0.50))
+                  .metric("p99_ns", pick(0.99))
+                  .metric("p999_ns", pick(0.999));
+        }
+    };
+
+    // 测试运行上下文
+    struct Context {
+        bool quick = false;            // 快速模式：缩小规模，用于冒烟检查
+        std::string suiteFilter;       // 只运行指定的测试组
+        std::vector<Result> results;
+
+        bool enabled(const std::string& suite) const {
+            return suiteFilter.empty() || suiteFilter == suite;
+        }
+        // 根据模式缩放迭代次数
+        size_t scale(size_t full) const {
+            return quick ? std::max<size_t>(full / 20, 1) : full;
+        }
+        Result& add(const std::string& suite, const std::string& name) {
+            results.push_back(Result{suite, name, {}, {}});
+            return results.back();
+        }
+    };
+
+    // 临时屏蔽 std::cout（被测代码自带日志输出时使用）
+    class SilenceCout {
+    private:
+        struct NullBuffer : std::streambuf {
+            int overflow(int c) override { return c; }
+        };
+        NullBuffer nullBuffer;
+        std::streambuf* saved;
+
+    public:
+        SilenceCout() : saved(std::cout.rdbuf(&nullBuffer)) {}
+        ~SilenceCout() { std::cout.rdbuf(saved); }
+        SilenceCout(const SilenceCout&) = delete;
+        SilenceCout& operator=(const SilenceCout&) = delete;
+    };
+
+    inline std::string escapeJson(const std::string& text) {
+        std::string out;
+        for (char c : text) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                default: out += c; break;
+            }
+        }
+        return out;
+    }
+
+    inline void writeJson(std::ostream& os, const Context& ctx) {
+        os << "{\n";
+        os << "  \"schema\": 1,\n";
+        os << "  \"timestamp\": " << static_cast<long long>(std::time(nullptr)) << ",\n";
+        os << "  \"quick\": " << (ctx.quick ? "true" : "false") << ",\n";
+        os << "  \"results\": [";
+        for (size_t i = 0; i < ctx.results.size(); ++i) {
+            const Result& r = ctx.results[i];
+            os << (i == 0 ? "\n" : ",\n");
+            os << "    {\"suite\": \"" << escapeJson(r.suite) << "\", \"name\": \""
+               << escapeJson(r.name) << "\", \"params\": {";
+            for (size_t j = 0; j < r.params.size(); ++j) {
+                os << (j == 0 ? "" : ", ") << "\"" << escapeJson(r.params[j].first) << "\": \""
+                   << escapeJson(r.params[j].second) << "\"";
+            }
+            os << "}, \"metrics\": {";
+            for (size_t j = 0; j < r.metrics.size(); ++j) {
+                std::ostringstream value;
+                value.precision(6);
+                value << std::fixed << r.metrics[j].second;
+                os << (j == 0 ? "" : ", ") << "\"" << escapeJson(r.metrics[j].first) << "\": "
+                   << value.str();
+            }
+            os << "}}";
+        }
+        os << "\n  ]\n}\n";
+    }
+}
+
+#endif // BENCHCOMMON_HPP
@@ -0,0 +1,867 @@
+#include "BenchCommon.hpp"
+#include "../RingBuffer/RingBuffer.hpp"
+#include "../RingBuffer/SpscRingBuffer.hpp"
+#include "../RingBuffer/MpmcRingBuffer.hpp"
+#include "../RingBuffer/BroadcastRingBuffer.hpp"
+#include "../RingBuffer/TaskScheduler.hpp"
+#include "../List/LinkedList.hpp"
+#include "../List/UnrolledList.hpp"
+#include "../List/LockFreeStack.hpp"
+#include "../List/SkipList.hpp"
+#include "../List/ConcurrentSkipList.hpp"
+#include "../ReaderEx/FileReader.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Bench;
+
+// ============================================================================
+// RingBuffer：单线程吞吐与单次调用延迟
+// ============================================================================
+
+// 指定字节数的元素，首 8 字节存放时间戳
+template <size_t Bytes>
+struct Payload {
+    static_assert(Bytes >= sizeof(uint64_t));
+    uint64_t stamp = 0;
+    char padding[Bytes - sizeof(uint64_t)] = {};
+};
+
+template <>
+struct Payload<sizeof(uint64_t)> {
+    uint64_t stamp = 0;
+};
+
+template <size_t Bytes>
+void benchRingBufferSingleThread(Context& ctx, size_t capacity, size_t batch) {
+    using Item = Payload<Bytes>;
+    RingBuffer<Item> rb(capacity, true);
+    const size_t rounds = ctx.scale(4000000) / batch;
+    std::vector<Item> in(batch);
+    std::vector<Item> out(batch);
+    LatencyRecorder latency(rounds / 16 + 1);
+
+    const uint64_t start = nowNanos();
+    for (size_t r = 0; r < rounds; ++r) {
+        // 每 16 轮对一次 push+pop 单独计时，避免计时开销主导结果
+        const bool sampled = (r & 15) == 0;
+        const uint64_t t0 = sampled ? nowNanos() : 0;
+        if (batch == 1) {
+            rb.push(in[0]);
+            rb.pop(out[0]);
+        } else {
+            rb.pushMultiple(in.data(), batch);
+            rb.popMultiple(out.data(), batch);
+        }
+        if (sampled) {
+            latency.record(nowNanos() - t0);
+        }
+    }
+    const uint64_t elapsed = nowNanos() - start;
+    doNotOptimize(out[0]);
+
+    const double ops = 2.0 * static_cast<double>(rounds * batch);
+    Result& result = ctx.add("RingBuffer", "push_pop_single_thread")
+        .param("element_bytes", Bytes)
+        .param("capacity", capacity)
+        .param("batch", batch)
+        .param("threads", 1)
+        .metric("ops_per_sec", ops * 1e9 / static_cast<double>(elapsed))
+        .metric("bytes_per_sec", ops * Bytes * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+// ============================================================================
+// RingBuffer：跨线程吞吐与端到端延迟（元素自带写入时间戳）
+// ============================================================================
+template <size_t Bytes>
+void benchSpsc(Context& ctx, size_t capacity) {
+    using Item = Payload<Bytes>;
+    SpscRingBuffer<Item> rb(capacity);
+    const size_t count = ctx.scale(2000000);
+    LatencyRecorder latency(count / 16 + 1);
+
+    const uint64_t start = nowNanos();
+    std::thread producer([&rb, count]() {
+        Item item;
+        for (size_t i = 0; i < count; ++i) {
+            item.stamp = (i & 15) == 0 ? nowNanos() : 0;
+            while (!rb.push(item)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    Item item;
+    for (size_t i = 0; i < count; ++i) {
+        while (!rb.pop(item)) {
+            std::this_thread::yield();
+        }
+        if (item.stamp != 0) {
+            latency.record(nowNanos() - item.stamp);
+        }
+    }
+    producer.join();
+    const uint64_t elapsed = nowNanos() - start;
+
+    Result& result = ctx.add("RingBuffer", "spsc_transfer")
+        .param("element_bytes", Bytes)
+        .param("capacity", capacity)
+        .param("batch", 1)
+        .param("threads", 2)
+        .metric("ops_per_sec", static_cast<double>(count) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+// 消费者用 consume_all 整批回调：每批只发布一次 head
+template <size_t Bytes>
+void benchSpscConsumeAll(Context& ctx, size_t capacity) {
+    using Item = Payload<Bytes>;
+    SpscRingBuffer<Item> rb(capacity);
+    const size_t count = ctx.scale(2000000);
+    LatencyRecorder latency(count / 16 + 1);
+
+    const uint64_t start = nowNanos();
+    std::thread producer([&rb, count]() {
+        Item item;
+        for (size_t i = 0; i < count; ++i) {
+            item.stamp = (i & 15) == 0 ? nowNanos() : 0;
+            while (!rb.push(item)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    size_t received = 0;
+    while (received < count) {
+        const size_t n = rb.consume_all([&latency](const Item& item) {
+            if (item.stamp != 0) {
+                latency.record(nowNanos() - item.stamp);
+            }
+        });
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        received += n;
+    }
+    producer.join();
+    const uint64_t elapsed = nowNanos() - start;
+
+    Result& result = ctx.add("RingBuffer", "spsc_consume_all")
+        .param("element_bytes", Bytes)
+        .param("capacity", capacity)
+        .param("threads", 2)
+        .metric("ops_per_sec", static_cast<double>(count) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+template <size_t Bytes>
+void benchMpmc(Context& ctx, size_t capacity, size_t producers, size_t consumers) {
+    using Item = Payload<Bytes>;
+    MpmcRingBuffer<Item> q(capacity);
+    const size_t perProducer = ctx.scale(1000000) / producers;
+    const size_t total = perProducer * producers;
+    std::atomic<size_t> consumed{0};
+    std::vector<LatencyRecorder> latencies(consumers);
+    std::vector<std::thread> threads;
+
+    const uint64_t start = nowNanos();
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, perProducer]() {
+            Item item;
+            for (size_t i = 0; i < perProducer; ++i) {
+                item.stamp = (i & 15) == 0 ? nowNanos() : 0;
+                while (!q.push(item)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&q, &consumed, &latencies, c, total]() {
+            Item item;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (!q.pop(item)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                consumed.fetch_add(1, std::memory_order_relaxed);
+                if (item.stamp != 0) {
+                    latencies[c].record(nowNanos() - item.stamp);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const uint64_t elapsed = nowNanos() - start;
+
+    LatencyRecorder merged;
+    for (const auto& l : latencies) {
+        merged.merge(l);
+    }
+    Result& result = ctx.add("RingBuffer", "mpmc_transfer")
+        .param("element_bytes", Bytes)
+        .param("capacity", capacity)
+        .param("batch", 1)
+        .param("threads", producers + consumers)
+        .metric("ops_per_sec", static_cast<double>(total) * 1e9 / static_cast<double>(elapsed));
+    merged.report(result);
+}
+
+// 广播：一个生产者写一次，consumers 个消费者各自读完整条流
+template <size_t Bytes>
+void benchBroadcast(Context& ctx, size_t capacity, size_t consumers) {
+    using Item = Payload<Bytes>;
+    BroadcastRingBuffer<Item> rb(capacity);
+    for (size_t c = 0; c < consumers; ++c) {
+        rb.addConsumer();
+    }
+    const size_t count = ctx.scale(2000000);
+    std::vector<LatencyRecorder> latencies(consumers);
+    std::vector<std::thread> threads;
+
+    const uint64_t start = nowNanos();
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&rb, &latencies, c, count]() {
+            size_t received = 0;
+            while (received < count) {
+                const size_t n = rb.consume(c, [&latencies, c](const Item& item) {
+                    if (item.stamp != 0) {
+                        latencies[c].record(nowNanos() - item.stamp);
+                    }
+                });
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+                received += n;
+            }
+        });
+    }
+    Item item;
+    for (size_t i = 0; i < count; ++i) {
+        item.stamp = (i & 15) == 0 ? nowNanos() : 0;
+        while (!rb.push(item)) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const uint64_t elapsed = nowNanos() - start;
+
+    LatencyRecorder merged;
+    for (const auto& l : latencies) {
+        merged.merge(l);
+    }
+    Result& result = ctx.add("RingBuffer", "broadcast_transfer")
+        .param("element_bytes", Bytes)
+        .param("capacity", capacity)
+        .param("consumers", consumers)
+        .metric("ops_per_sec", static_cast<double>(count) * 1e9 / static_cast<double>(elapsed));
+    merged.report(result);
+}
+
+void runRingBufferSuite(Context& ctx) {
+    for (size_t capacity : {size_t{1024}, size_t{65536}}) {
+        for (size_t batch : {size_t{1}, size_t{64}}) {
+            benchRingBufferSingleThread<8>(ctx, capacity, batch);
+            benchRingBufferSingleThread<64>(ctx, capacity, batch);
+            benchRingBufferSingleThread<256>(ctx, capacity, batch);
+        }
+        benchSpsc<8>(ctx, capacity);
+        benchSpsc<64>(ctx, capacity);
+        benchSpscConsumeAll<8>(ctx, capacity);
+        benchSpscConsumeAll<64>(ctx, capacity);
+    }
+    for (size_t threads : {size_t{1}, size_t{2}, size_t{4}}) {
+        benchMpmc<8>(ctx, 1024, threads, threads);
+    }
+    for (size_t consumers : {size_t{1}, size_t{2}, size_t{4}}) {
+        benchBroadcast<64>(ctx, 1024, consumers);
+    }
+}
+
+// ============================================================================
+// ModernVersion::LinkedList：push_front / pop_front
+// ============================================================================
+// sharedPool 为空时每轮的链表使用自己的节点池，否则所有轮次共享同一个池（slab 只分配一次）
+void benchLinkedListPushPop(Context& ctx, size_t n, const std::shared_ptr<ModernVersion::NodePool>& sharedPool) {
+    const size_t rounds = std::max<size_t>(ctx.scale(2000000) / n, 1);
+    LatencyRecorder latency(rounds);
+    uint64_t pushNanos = 0;
+    uint64_t popNanos = 0;
+
+    for (size_t r = 0; r < rounds; ++r) {
+        ModernVersion::LinkedList list(sharedPool);
+        uint64_t t0 = nowNanos();
+        for (size_t i = 0; i < n; ++i) {
+            list.push_front(static_cast<int>(i));
+        }
+        uint64_t t1 = nowNanos();
+        for (size_t i = 0; i < n; ++i) {
+            auto node = list.pop_front();
+            doNotOptimize(node.get());
+        }
+        uint64_t t2 = nowNanos();
+        pushNanos += t1 - t0;
+        popNanos += t2 - t1;
+        latency.record((t2 - t0) / (2 * n));
+    }
+
+    const double ops = static_cast<double>(rounds * n);
+    Result& result = ctx.add("LinkedList", sharedPool ? "push_front_pop_front_shared_pool"
+                                                      : "push_front_pop_front")
+        .param("elements", n)
+        .metric("push_ops_per_sec", ops * 1e9 / static_cast<double>(pushNanos))
+        .metric("pop_ops_per_sec", ops * 1e9 / static_cast<double>(popNanos));
+    latency.report(result);  // 每轮的平均单次操作耗时分布
+}
+
+// 整条链表的析构耗时：两个版本都以循环释放节点，长链表不会耗尽栈
+template <typename List>
+void benchLinkedListTeardown(Context& ctx, const char* version, size_t n) {
+    auto list = std::make_unique<List>();
+    for (size_t i = 0; i < n; ++i) {
+        list->push_front(static_cast<int>(i));
+    }
+
+    const uint64_t t0 = nowNanos();
+    list.reset();
+    const uint64_t elapsed = nowNanos() - t0;
+
+    ctx.add("LinkedList", "teardown")
+        .param("version", version)
+        .param("elements", n)
+        .metric("seconds", static_cast<double>(elapsed) / 1e9)
+        .metric("nodes_per_sec", static_cast<double>(n) * 1e9 / static_cast<double>(elapsed));
+}
+
+// 遍历求和：每个元素一个节点（ModernVersion）对比每个节点一段连续元素（UnrolledVersion）
+template <typename SumFn>
+void reportTraversal(Context& ctx, const char* layout, size_t n, size_t nodes, SumFn&& sum) {
+    constexpr size_t PASSES = 5;
+    LatencyRecorder latency(PASSES);
+    long long total = 0;
+    uint64_t elapsed = 0;
+    for (size_t pass = 0; pass < PASSES; ++pass) {
+        const uint64_t t0 = nowNanos();
+        total += sum();
+        const uint64_t t1 = nowNanos();
+        elapsed += t1 - t0;
+        latency.record(t1 - t0);  // 每遍耗时
+    }
+    doNotOptimize(total);
+
+    Result& result = ctx.add("LinkedList", "traverse_sum")
+        .param("layout", layout)
+        .param("elements", n)
+        .param("nodes", nodes)
+        .metric("elements_per_sec", static_cast<double>(n * PASSES) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+void benchLinkedListTraversal(Context& ctx, size_t n) {
+    {
+        ModernVersion::LinkedList list;
+        for (size_t i = 0; i < n; ++i) {
+            list.push_front(static_cast<int>(i));
+        }
+        reportTraversal(ctx, "node_per_element", n, n, [&list]() {
+            long long sum = 0;
+            for (const ModernVersion::Node* node = list.getHead(); node; node = node->next.get()) {
+                sum += node->data;
+            }
+            return sum;
+        });
+    }
+    {
+        UnrolledVersion::LinkedList<int> list;
+        for (size_t i = 0; i < n; ++i) {
+            list.push_back(static_cast<int>(i));
+        }
+        reportTraversal(ctx, "unrolled", n, list.nodeCount(), [&list]() {
+            long long sum = 0;
+            for (int value : list) {
+                sum += value;
+            }
+            return sum;
+        });
+    }
+}
+
+// 原地排序 / 去重，对比拷贝到 std::vector 处理后再重建链表
+ModernVersion::LinkedList makeRandomList(size_t n, int range) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, range - 1);
+    ModernVersion::LinkedList list;
+    for (size_t i = 0; i < n; ++i) {
+        list.push_back(dist(rng));
+    }
+    return list;
+}
+
+std::vector<int> copyToVector(const ModernVersion::LinkedList& list) {
+    std::vector<int> values;
+    for (const ModernVersion::Node* node = list.getHead(); node; node = node->next.get()) {
+        values.push_back(node->data);
+    }
+    return values;
+}
+
+template <typename Op>
+void benchListAlgorithm(Context& ctx, const char* name, const char* impl, size_t n, int range, Op&& op) {
+    constexpr size_t ROUNDS = 3;
+    LatencyRecorder latency(ROUNDS);
+    uint64_t elapsed = 0;
+    for (size_t r = 0; r < ROUNDS; ++r) {
+        ModernVersion::LinkedList list = makeRandomList(n, range);
+        const uint64_t t0 = nowNanos();
+        op(list);
+        const uint64_t t1 = nowNanos();
+        elapsed += t1 - t0;
+        latency.record(t1 - t0);  // 每轮耗时
+        doNotOptimize(list.getHead());
+    }
+
+    Result& result = ctx.add("LinkedList", name)
+        .param("impl", impl)
+        .param("elements", n)
+        .metric("elements_per_sec", static_cast<double>(n * ROUNDS) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+void benchListAlgorithms(Context& ctx, size_t n) {
+    const int wide = 1 << 30;  // 几乎没有重复
+    const int narrow = 1000;   // 大量重复，用于去重
+
+    benchListAlgorithm(ctx, "sort", "in_place", n, wide, [](ModernVersion::LinkedList& list) {
+        list.sort();
+    });
+    benchListAlgorithm(ctx, "sort", "vector_round_trip", n, wide, [](ModernVersion::LinkedList& list) {
+        std::vector<int> values = copyToVector(list);
+        std::sort(values.begin(), values.end());
+        list = ModernVersion::LinkedList(values.begin(), values.end());
+    });
+    benchListAlgorithm(ctx, "dedupe", "in_place", n, narrow, [](ModernVersion::LinkedList& list) {
+        list.sort();
+        list.unique();
+    });
+    benchListAlgorithm(ctx, "dedupe", "vector_round_trip", n, narrow, [](ModernVersion::LinkedList& list) {
+        std::vector<int> values = copyToVector(list);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        list = ModernVersion::LinkedList(values.begin(), values.end());
+    });
+}
+
+// 多线程竞争：每个线程交替 push / pop，对比加锁的 ModernVersion::LinkedList 与无锁栈
+template <typename PushPop>
+void benchStackContention(Context& ctx, const char* impl, size_t threadCount, PushPop&& pushPop) {
+    const size_t perThread = std::max<size_t>(ctx.scale(2000000) / threadCount, 1);
+    LatencyRecorder latency(threadCount * (perThread / 64 + 1));
+    std::mutex latencyMutex;
+    std::vector<std::thread> threads;
+
+    const uint64_t start = nowNanos();
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            LatencyRecorder local(perThread / 64 + 1);
+            for (size_t i = 0; i < perThread; ++i) {
+                // 每 64 次对一次 push+pop 单独计时
+                const bool sampled = (i & 63) == 0;
+                const uint64_t t0 = sampled ? nowNanos() : 0;
+                pushPop(static_cast<int>(t * perThread + i));
+                if (sampled) {
+                    local.record(nowNanos() - t0);
+                }
+            }
+            std::lock_guard<std::mutex> lock(latencyMutex);
+            latency.merge(local);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const uint64_t elapsed = nowNanos() - start;
+
+    const double ops = 2.0 * static_cast<double>(perThread * threadCount);
+    Result& result = ctx.add("LinkedList", "stack_contention")
+        .param("impl", impl)
+        .param("threads", threadCount)
+        .metric("ops_per_sec", ops * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+void benchStackContention(Context& ctx, size_t threadCount) {
+    {
+        std::mutex mutex;
+        ModernVersion::LinkedList list;
+        benchStackContention(ctx, "mutex_list", threadCount, [&](int value) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                list.push_front(value);
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            auto node = list.pop_front();  // 节点归还给池，必须在锁内销毁
+            doNotOptimize(node.get());
+        });
+    }
+    {
+        ConcurrentVersion::LockFreeStack<int> stack;
+        benchStackContention(ctx, "lock_free", threadCount, [&](int value) {
+            stack.push(value);
+            auto popped = stack.pop();
+            doNotOptimize(popped);
+        });
+    }
+}
+
+void runLinkedListSuite(Context& ctx) {
+    for (size_t n : {size_t{1000}, size_t{100000}}) {
+        benchLinkedListPushPop(ctx, n, nullptr);
+        benchLinkedListPushPop(ctx, n, ModernVersion::NodePool::create());
+    }
+    for (size_t n : {size_t{1000000}, size_t{10000000}, size_t{100000000}}) {
+        benchLinkedListTeardown<OldVersion::LinkedList>(ctx, "old", ctx.scale(n));
+        benchLinkedListTeardown<ModernVersion::LinkedList>(ctx, "modern", ctx.scale(n));
+    }
+    benchLinkedListTraversal(ctx, ctx.scale(10000000));
+    for (size_t n : {size_t{100000}, size_t{1000000}}) {
+        benchListAlgorithms(ctx, ctx.scale(n));
+    }
+    for (size_t threads : {size_t{1}, size_t{2}, size_t{4}, size_t{8}, size_t{16}, size_t{32}, size_t{64}}) {
+        benchStackContention(ctx, threads);
+    }
+}
+
+// ============================================================================
+// SkipList：与 std::set 对比插入、查找、区间查询、删除，以及读多写少的并发读
+// ============================================================================
+std::vector<uint64_t> makeShuffledKeys(size_t n, uint64_t seed) {
+    std::vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = i * 2;  // 偶数键常驻，奇数键留给并发测试的写者
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(seed));
+    return keys;
+}
+
+// 对 keys 逐个执行 op，每 64 次单独计时一次
+template <typename Op>
+void benchOrderedPhase(Context& ctx, const char* name, const char* impl, const std::vector<uint64_t>& keys, Op&& op) {
+    LatencyRecorder latency(keys.size() / 64 + 1);
+    const uint64_t start = nowNanos();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if ((i & 63) == 0) {
+            const uint64_t t0 = nowNanos();
+            op(keys[i]);
+            latency.record(nowNanos() - t0);
+        } else {
+            op(keys[i]);
+        }
+    }
+    const uint64_t elapsed = nowNanos() - start;
+
+    Result& result = ctx.add("SkipList", name)
+        .param("impl", impl)
+        .param("elements", keys.size())
+        .metric("ops_per_sec", static_cast<double>(keys.size()) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+// OrderedVersion::SkipList 与 std::set 的接口在这里用到的部分一致
+template <typename Set>
+void benchOrderedIndex(Context& ctx, const char* impl, size_t n) {
+    constexpr uint64_t RANGE_WIDTH = 200;  // 每次区间查询约覆盖 100 个键
+    const std::vector<uint64_t> inserts = makeShuffledKeys(n, 1);
+    const std::vector<uint64_t> lookups = makeShuffledKeys(n, 2);
+    const std::vector<uint64_t> ranges(lookups.begin(), lookups.begin() + static_cast<std::ptrdiff_t>(std::max<size_t>(n / 100, 1)));
+
+    Set set;
+    size_t hits = 0;
+    benchOrderedPhase(ctx, "insert", impl, inserts, [&](uint64_t key) { set.insert(key); });
+    benchOrderedPhase(ctx, "find", impl, lookups, [&](uint64_t key) { hits += set.find(key) != set.end() ? size_t{1} : size_t{0}; });
+    benchOrderedPhase(ctx, "range_100", impl, ranges, [&](uint64_t key) {
+        for (auto it = set.lower_bound(key); it != set.end() && *it < key + RANGE_WIDTH; ++it) {
+            hits += *it & 1;
+        }
+    });
+    benchOrderedPhase(ctx, "erase", impl, lookups, [&](uint64_t key) { set.erase(key); });
+    doNotOptimize(hits);
+}
+
+// 一个写者不断插入/删除奇数键，readerCount 个读者查找常驻的偶数键
+template <typename Insert, typename Erase, typename Contains>
+void benchConcurrentReads(Context& ctx, const char* impl, size_t n, size_t readerCount,
+                          Insert&& insert, Erase&& erase, Contains&& contains) {
+    const size_t perReader = ctx.scale(1000000);
+    LatencyRecorder latency(readerCount * (perReader / 64 + 1));
+    std::mutex latencyMutex;
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> writes{0};
+
+    std::thread writer([&]() {
+        std::mt19937_64 rng(7);
+        size_t local = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            const uint64_t key = (rng() % n) * 2 + 1;
+            if (rng() & 1) {
+                insert(key);
+            } else {
+                erase(key);
+            }
+            ++local;
+        }
+        writes.store(local, std::memory_order_relaxed);
+    });
+
+    std::vector<std::thread> readers;
+    const uint64_t start = nowNanos();
+    for (size_t t = 0; t < readerCount; ++t) {
+        readers.emplace_back([&, t]() {
+            std::mt19937_64 rng(t + 100);
+            LatencyRecorder local(perReader / 64 + 1);
+            size_t hits = 0;
+            for (size_t i = 0; i < perReader; ++i) {
+                const uint64_t key = (rng() % n) * 2;
+                if ((i & 63) == 0) {
+                    const uint64_t t0 = nowNanos();
+                    hits += contains(key) ? size_t{1} : size_t{0};
+                    local.record(nowNanos() - t0);
+                } else {
+                    hits += contains(key) ? size_t{1} : size_t{0};
+                }
+            }
+            doNotOptimize(hits);
+            std::lock_guard<std::mutex> lock(latencyMutex);
+            latency.merge(local);
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    const uint64_t elapsed = nowNanos() - start;
+    stop.store(true, std::memory_order_relaxed);
+    writer.join();
+
+    Result& result = ctx.add("SkipList", "concurrent_reads")
+        .param("impl", impl)
+        .param("elements", n)
+        .param("readers", readerCount)
+        .metric("read_ops_per_sec", static_cast<double>(perReader * readerCount) * 1e9 / static_cast<double>(elapsed))
+        .metric("write_ops_per_sec", static_cast<double>(writes.load()) * 1e9 / static_cast<double>(elapsed));
+    latency.report(result);
+}
+
+void benchConcurrentReads(Context& ctx, size_t n, size_t readerCount) {
+    const std::vector<uint64_t> keys = makeShuffledKeys(n, 3);
+    {
+        ConcurrentVersion::ConcurrentSkipList<uint64_t> list;
+        for (uint64_t key : keys) {
+            list.insert(key);
+        }
+        benchConcurrentReads(ctx, "concurrent_skip_list", n, readerCount,
+            [&](uint64_t key) { list.insert(key); },
+            [&](uint64_t key) { list.erase(key); },
+            [&](uint64_t key) { return list.contains(key); });
+    }
+    {
+        std::shared_mutex mutex;
+        std::set<uint64_t> set(keys.begin(), keys.end());
+        benchConcurrentReads(ctx, "set_shared_mutex", n, readerCount,
+            [&](uint64_t key) { std::unique_lock<std::shared_mutex> lock(mutex); set.insert(key); },
+            [&](uint64_t key) { std::unique_lock<std::shared_mutex> lock(mutex); set.erase(key); },
+            [&](uint64_t key) { std::shared_lock<std::shared_mutex> lock(mutex); return set.count(key) != 0; });
+    }
+}
+
+void runSkipListSuite(Context& ctx) {
+    for (size_t n : {size_t{100000}, size_t{1000000}}) {
+        benchOrderedIndex<OrderedVersion::SkipList<uint64_t>>(ctx, "skip_list", ctx.scale(n));
+        benchOrderedIndex<std::set<uint64_t>>(ctx, "std_set", ctx.scale(n));
+    }
+    for (size_t readers : {size_t{1}, size_t{2}, size_t{4}}) {
+        benchConcurrentReads(ctx, ctx.scale(1000000), readers);
+    }
+}
+
+// ============================================================================
+// FileReader：readAll / readLine 吞吐
+// ============================================================================
+void runFileReaderSuite(Context& ctx) {
+    const std::string path = "benchmark_input.tmp";
+    const size_t lineCount = ctx.scale(1000000);
+    const std::string line = "0123456789abcdefghijklmnopqrstuvwxyz,ABCDEFGHIJKLMNOPQRSTUVWXYZ;0123456789";
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (size_t i = 0; i < lineCount; ++i) {
+            out << line << '\n';
+        }
+    }
+    const double bytes = static_cast<double>(lineCount * (line.size() + 1));
+
+    SilenceCout silence;  // FileReader 打开/关闭时会打印日志
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        uint64_t t0 = nowNanos();
+        {
+            FileReader reader(path);
+            std::string content = reader.readAll();
+            doNotOptimize(content.data());
+        }
+        uint64_t t1 = nowNanos();
+        {
+            FileReader reader(path);
+            std::string current;
+            size_t lines = 0;
+            while (reader.readLine(current)) {
+                ++lines;
+            }
+            doNotOptimize(lines);
+        }
+        uint64_t t2 = nowNanos();
+
+        ctx.add("FileReader", "readAll")
+            .param("bytes", static_cast<uint64_t>(bytes))
+            .param("repeat", static_cast<uint64_t>(repeat))
+            .metric("gb_per_sec", bytes / static_cast<double>(t1 - t0));
+        ctx.add("FileReader", "readLine")
+            .param("bytes", static_cast<uint64_t>(bytes))
+            .param("repeat", static_cast<uint64_t>(repeat))
+            .metric("gb_per_sec", bytes / static_cast<double>(t2 - t1));
+    }
+    std::remove(path.c_str());
+}
+
+// ============================================================================
+// TaskScheduler：递归 fork/join 与 parallel_for 的扩展性
+// ============================================================================
+static uint64_t fibSerial(unsigned n) {
+    return n < 2 ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+static uint64_t fibTask(TaskScheduler& scheduler, unsigned n) {
+    if (n < 18) {
+        return fibSerial(n);  // 截断：太小的子问题不再派生任务
+    }
+    uint64_t left = 0;
+    TaskScheduler::TaskGroup group(scheduler);
+    group.run([&scheduler, &left, n]() { left = fibTask(scheduler, n - 1); });
+    const uint64_t right = fibTask(scheduler, n - 2);
+    group.wait();
+    return left + right;
+}
+
+void runSchedulerSuite(Context& ctx) {
+    const unsigned fibN = ctx.quick ? 27 : 34;
+    const size_t forCount = ctx.scale(20000000);
+    std::vector<double> values(forCount);
+
+    std::vector<size_t> threadCounts = {1, 2, 4, 8};
+    const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    if (std::find(threadCounts.begin(), threadCounts.end(), hardware) == threadCounts.end()) {
+        threadCounts.push_back(hardware);
+    }
+
+    double fibBaseline = 0;
+    double forBaseline = 0;
+    for (size_t threads : threadCounts) {
+        TaskScheduler scheduler(threads);
+
+        // 在调度器线程之外调用：根任务经注入队列进入，随后全部在工作线程间窃取
+        uint64_t t0 = nowNanos();
+        uint64_t fib = 0;
+        {
+            TaskScheduler::TaskGroup root(scheduler);
+            root.run([&scheduler, &fib, fibN]() { fib = fibTask(scheduler, fibN); });
+        }
+        const double fibSeconds = static_cast<double>(nowNanos() - t0) * 1e-9;
+        doNotOptimize(fib);
+        if (threads == 1) {
+            fibBaseline = fibSeconds;
+        }
+        ctx.add("Scheduler", "fork_join_fib")
+            .param("n", fibN)
+            .param("threads", threads)
+            .metric("seconds", fibSeconds)
+            .metric("speedup", fibBaseline / fibSeconds);
+
+        t0 = nowNanos();
+        scheduler.parallel_for(0, forCount, 4096, [&values](size_t i) {
+            values[i] = std::sqrt(static_cast<double>(i)) * 1.000001;
+        });
+        const double forSeconds = static_cast<double>(nowNanos() - t0) * 1e-9;
+        doNotOptimize(values[forCount / 2]);
+        if (threads == 1) {
+            forBaseline = forSeconds;
+        }
+        ctx.add("Scheduler", "parallel_for")
+            .param("elements", forCount)
+            .param("grain", 4096)
+            .param("threads", threads)
+            .metric("seconds", forSeconds)
+            .metric("speedup", forBaseline / forSeconds);
+    }
+}
+
+// ============================================================================
+// 入口：benchmark [--quick] [--suite 名称] [--output 文件]
+// ============================================================================
+int main(int argc, char** argv) {
+    Context ctx;
+    std::string outputPath;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--quick") {
+            ctx.quick = true;
+        } else if (arg == "--suite" && i + 1 < argc) {
+            ctx.suiteFilter = argv[++i];
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "用法: " << argv[0] << " [--quick] [--suite 名称] [--output 文件]" << std::endl;
+            return 1;
+        }
+    }
+
+    const std::pair<const char*, void (*)(Context&)> suites[] = {
+        {"RingBuffer", runRingBufferSuite},
+        {"Scheduler", runSchedulerSuite},
+        {"LinkedList", runLinkedListSuite},
+        {"SkipList", runSkipListSuite},
+        {"FileReader", runFileReaderSuite},
+    };
+
+    try {
+        for (const auto& [name, run] : suites) {
+            if (ctx.enabled(name)) {
+                std::cerr << "运行测试组: " << name << std::endl;
+                run(ctx);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (outputPath.empty()) {
+        writeJson(std::cout, ctx);
+    } else {
+        std::ofstream out(outputPath);
+        writeJson(out, ctx);
+        std::cerr << "结果已写入: " << outputPath << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,264 @@
+#ifndef CONCURRENTSKIPLIST_CPP
+#define CONCURRENTSKIPLIST_CPP
+
+#include "ConcurrentSkipList.hpp"
+#include <new>
+#include <utility>
+
+namespace ConcurrentVersion {
+    // ========================================================================
+    // 读者登记
+    // ========================================================================
+    template <typename Key, typename Compare>
+    std::atomic<size_t>& ConcurrentSkipList<Key, Compare>::ReadGuard::enter(const ConcurrentSkipList& list) noexcept {
+        for (;;) {
+            const uint64_t e = list.epoch.load(std::memory_order_seq_cst);
+            std::atomic<size_t>& counter = list.readers[e & 1];
+            counter.fetch_add(1, std::memory_order_seq_cst);
+            // 加一之后纪元仍未推进，写者回收前一定能看到这次登记
+            if (list.epoch.load(std::memory_order_seq_cst) == e) {
+                return counter;
+            }
+            counter.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Key, typename Compare>
+    ConcurrentSkipList<Key, Compare>::ReadGuard::ReadGuard(const ConcurrentSkipList& list) noexcept
+        : slot(enter(list)) {}
+
+    template <typename Key, typename Compare>
+    ConcurrentSkipList<Key, Compare>::ReadGuard::~ReadGuard() {
+        slot.fetch_sub(1, std::memory_order_release);
+    }
+
+    // ========================================================================
+    // 构造与析构
+    // ========================================================================
+    template <typename Key, typename Compare>
+    ConcurrentSkipList<Key, Compare>::ConcurrentSkipList(Compare compare)
+        : height(1), count(0), comp(std::move(compare)),
+          arena(sizeof(Node), sizeof(std::atomic<Node*>)), rng(0x9E3779B97F4A7C15ull), epoch(0) {
+        for (std::atomic<Node*>& head : heads) {
+            head.store(nullptr, std::memory_order_relaxed);
+        }
+        readers[0].store(0, std::memory_order_relaxed);
+        readers[1].store(0, std::memory_order_relaxed);
+    }
+
+    template <typename Key, typename Compare>
+    ConcurrentSkipList<Key, Compare>::~ConcurrentSkipList() {
+        Node* node = heads[0].load(std::memory_order_acquire);
+        while (node) {
+            Node* next = node->tower()[0].load(std::memory_order_relaxed);
+            destroyNode(node);
+            node = next;
+        }
+        for (std::vector<Node*>& list : retired) {
+            for (Node* doomed : list) {
+                destroyNode(doomed);
+            }
+        }
+    }
+
+    template <typename Key, typename Compare>
+    void ConcurrentSkipList<Key, Compare>::destroyNode(Node* node) noexcept {
+        const size_t h = node->height;
+        node->~Node();  // 塔中的 std::atomic<Node*> 可平凡析构
+        arena.deallocate(node, h);
+    }
+
+    // ========================================================================
+    // 查找路径
+    // ========================================================================
+    template <typename Key, typename Compare>
+    std::atomic<typename ConcurrentSkipList<Key, Compare>::Node*>&
+    ConcurrentSkipList<Key, Compare>::linkOf(Node* pred, size_t level) noexcept {
+        return pred ? pred->tower()[level] : heads[level];
+    }
+
+    template <typename Key, typename Compare>
+    typename ConcurrentSkipList<Key, Compare>::Node*
+    ConcurrentSkipList<Key, Compare>::lowerBoundNode(const Key& key) const noexcept {
+        // 必须返回第 0 层比较过的那个后继：重新读取 x 的链接时，写者可能刚在 x 之后插入了更小的键
+        Node* x = nullptr;
+        Node* n = nullptr;
+        for (size_t level = height.load(std::memory_order_acquire); level-- > 0;) {
+            for (;;) {
+                n = x ? x->tower()[level].load(std::memory_order_acquire)
+                      : heads[level].load(std::memory_order_acquire);
+                if (!n || !comp(n->key, key)) {
+                    break;
+                }
+                x = n;
+            }
+        }
+        return n;
+    }
+
+    template <typename Key, typename Compare>
+    void ConcurrentSkipList<Key, Compare>::findPredecessors(const Key& key, Node** preds) noexcept {
+        // 链接只在锁内修改，写者自己读取时无需同步
+        Node* x = nullptr;
+        for (size_t level = height.load(std::memory_order_relaxed); level-- > 0;) {
+            for (;;) {
+                Node* n = linkOf(x, level).load(std::memory_order_relaxed);
+                if (!n || !comp(n->key, key)) {
+                    break;
+                }
+                x = n;
+            }
+            preds[level] = x;
+        }
+    }
+
+    template <typename Key, typename Compare>
+    size_t ConcurrentSkipList<Key, Compare>::randomHeight() noexcept {
+        size_t h = 1;
+        while (h < MAX_HEIGHT) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            if (rng % BRANCHING != 0) {
+                break;
+            }
+            ++h;
+        }
+        return h;
+    }
+
+    // ========================================================================
+    // 写操作
+    // ========================================================================
+    template <typename Key, typename Compare>
+    bool ConcurrentSkipList<Key, Compare>::insert(const Key& key) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        Node* preds[MAX_HEIGHT];
+        findPredecessors(key, preds);
+        Node* candidate = linkOf(preds[0], 0).load(std::memory_order_relaxed);
+        if (candidate && !comp(key, candidate->key)) {
+            return false;
+        }
+
+        const size_t h = randomHeight();
+        const size_t current = height.load(std::memory_order_relaxed);
+        for (size_t level = current; level < h; ++level) {
+            preds[level] = nullptr;
+        }
+
+        void* memory = arena.allocate(h);
+        Node* node;
+        try {
+            node = new (memory) Node(key, static_cast<uint32_t>(h));
+        } catch (...) {
+            arena.deallocate(memory, h);
+            throw;
+        }
+        std::atomic<Node*>* tower = node->tower();
+        for (size_t level = 0; level < h; ++level) {
+            new (&tower[level]) std::atomic<Node*>(linkOf(preds[level], level).load(std::memory_order_relaxed));
+        }
+
+        // 塔已完整：自底向上发布，读者在任何一层看到新节点时其各层后继都已有效
+        for (size_t level = 0; level < h; ++level) {
+            linkOf(preds[level], level).store(node, std::memory_order_release);
+        }
+        if (h > current) {
+            height.store(h, std::memory_order_release);
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    template <typename Key, typename Compare>
+    bool ConcurrentSkipList<Key, Compare>::erase(const Key& key) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+
+        Node* preds[MAX_HEIGHT];
+        findPredecessors(key, preds);
+        Node* target = linkOf(preds[0], 0).load(std::memory_order_relaxed);
+        if (!target || comp(key, target->key)) {
+            return false;
+        }
+
+        // 先登记到回收列表（可能分配内存），之后的摘链不会失败
+        retired[epoch.load(std::memory_order_relaxed) & 1].push_back(target);
+
+        // 自顶向下摘链；target 的塔保持不变，停在它上面的读者仍能走到后继
+        std::atomic<Node*>* tower = target->tower();
+        for (size_t level = target->height; level-- > 0;) {
+            linkOf(preds[level], level).store(tower[level].load(std::memory_order_relaxed), std::memory_order_release);
+        }
+        size_t h = height.load(std::memory_order_relaxed);
+        while (h > 1 && !heads[h - 1].load(std::memory_order_relaxed)) {
+            --h;
+        }
+        height.store(h, std::memory_order_release);
+        count.fetch_sub(1, std::memory_order_relaxed);
+        tryReclaim();
+        return true;
+    }
+
+    template <typename Key, typename Compare>
+    void ConcurrentSkipList<Key, Compare>::tryReclaim() noexcept {
+        // 纪元只由写者推进。上一纪元（与 e + 1 同奇偶）的读者全部离开后，
+        // 该纪元摘下的节点已不可达，可以释放，然后推进纪元复用这一组
+        const uint64_t e = epoch.load(std::memory_order_relaxed);
+        const size_t previous = (e + 1) & 1;
+        // 读到 0 即与读者离开时的 release 配对：它们对节点的读取都已结束
+        if (readers[previous].load(std::memory_order_seq_cst) != 0) {
+            return;
+        }
+        for (Node* doomed : retired[previous]) {
+            destroyNode(doomed);
+        }
+        retired[previous].clear();
+        epoch.store(e + 1, std::memory_order_seq_cst);
+    }
+
+    // ========================================================================
+    // 读操作
+    // ========================================================================
+    template <typename Key, typename Compare>
+    bool ConcurrentSkipList<Key, Compare>::contains(const Key& key) const {
+        ReadGuard guard(*this);
+        Node* node = lowerBoundNode(key);
+        return node && !comp(key, node->key);
+    }
+
+    template <typename Key, typename Compare>
+    std::optional<Key> ConcurrentSkipList<Key, Compare>::lower_bound(const Key& key) const {
+        ReadGuard guard(*this);
+        Node* node = lowerBoundNode(key);
+        if (!node) {
+            return std::nullopt;
+        }
+        return node->key;
+    }
+
+    template <typename Key, typename Compare>
+    template <typename F>
+    size_t ConcurrentSkipList<Key, Compare>::for_each_in_range(const Key& low, const Key& high, F&& f) const {
+        ReadGuard guard(*this);
+        size_t visited = 0;
+        for (Node* node = lowerBoundNode(low); node && comp(node->key, high);
+             node = node->tower()[0].load(std::memory_order_acquire)) {
+            f(node->key);
+            ++visited;
+        }
+        return visited;
+    }
+
+    template <typename Key, typename Compare>
+    bool ConcurrentSkipList<Key, Compare>::empty() const noexcept {
+        return count.load(std::memory_order_relaxed) == 0;
+    }
+
+    template <typename Key, typename Compare>
+    size_t ConcurrentSkipList<Key, Compare>::size() const noexcept {
+        return count.load(std::memory_order_relaxed);
+    }
+}
+
+#endif // CONCURRENTSKIPLIST_CPP
@@ -0,0 +1,106 @@
+#ifndef CONCURRENTSKIPLIST_HPP
+#define CONCURRENTSKIPLIST_HPP
+
+#include "SkipListArena.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// ============================================================================
+// 并发跳表有序集合：读者不加锁，写者之间用互斥锁串行化
+// - 写者在锁内修改，先填好新节点的整座塔，再自底向上以 release 发布各层链接；
+//   删除自顶向下摘链，被摘下的节点仍指向原来的后继，正在其上的读者可以继续前进
+// - 摘下的节点按纪元（epoch）延迟释放：读者进入时在当前纪元的计数器上加一，
+//   上一纪元的读者全部离开后，该纪元摘下的节点才回到 arena
+// 读者持续不断时回收会推迟，但不会阻塞写者。
+// ============================================================================
+namespace ConcurrentVersion {
+    template <typename Key, typename Compare = std::less<Key>>
+    class ConcurrentSkipList {
+    public:
+        static constexpr size_t MAX_HEIGHT = OrderedVersion::SkipListArena::MAX_HEIGHT;
+        static constexpr unsigned BRANCHING = 4;
+
+    private:
+        // 节点之后紧跟 height 个 std::atomic<Node*>（第 0 层在最前），与节点一起从 arena 分配
+        struct alignas(alignof(std::atomic<void*>)) Node {
+            Key key;
+            uint32_t height;
+
+            Node(const Key& k, uint32_t h) : key(k), height(h) {}
+            std::atomic<Node*>* tower() noexcept {
+                return reinterpret_cast<std::atomic<Node*>*>(reinterpret_cast<unsigned char*>(this) + sizeof(Node));
+            }
+        };
+
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        std::atomic<Node*> heads[MAX_HEIGHT];
+        std::atomic<size_t> height;
+        std::atomic<size_t> count;
+        Compare comp;
+
+        // 以下成员只由持有 writeMutex 的写者访问
+        std::mutex writeMutex;
+        OrderedVersion::SkipListArena arena;
+        std::vector<Node*> retired[2];  // 按摘下时纪元的奇偶分组
+        uint64_t rng;
+
+        // 读者只修改计数器，因此只读接口也能登记
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> epoch;
+        alignas(CACHE_LINE_SIZE) mutable std::atomic<size_t> readers[2];
+
+        // 读者在作用域内持有当前纪元
+        class ReadGuard {
+        private:
+            std::atomic<size_t>& slot;
+            static std::atomic<size_t>& enter(const ConcurrentSkipList& list) noexcept;
+
+        public:
+            explicit ReadGuard(const ConcurrentSkipList& list) noexcept;
+            ~ReadGuard();
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+        };
+
+        // pred 为空表示头结点
+        std::atomic<Node*>& linkOf(Node* pred, size_t level) noexcept;
+        Node* lowerBoundNode(const Key& key) const noexcept;  // 须在 ReadGuard 内调用
+        void findPredecessors(const Key& key, Node** preds) noexcept;  // 须持有 writeMutex
+        size_t randomHeight() noexcept;
+        void destroyNode(Node* node) noexcept;
+        void tryReclaim() noexcept;
+
+    public:
+        explicit ConcurrentSkipList(Compare compare = Compare());
+        // 析构时不能再有其他线程访问
+        ~ConcurrentSkipList();
+
+        ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+        ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+        // 写操作：互斥执行。键已存在 / 不存在时返回 false
+        bool insert(const Key& key);
+        bool erase(const Key& key);
+
+        // 读操作：不加锁，可与写操作并发
+        bool contains(const Key& key) const;
+        std::optional<Key> lower_bound(const Key& key) const;  // 第一个不小于 key 的元素的副本
+        // 依次对 [low, high) 中的元素调用 f(const Key&)，返回元素个数；
+        // 遍历期间并发插入、删除的元素可能看到也可能看不到
+        template <typename F>
+        size_t for_each_in_range(const Key& low, const Key& high, F&& f) const;
+
+        // 并发时为近似值
+        bool empty() const noexcept;
+        size_t size() const noexcept;
+    };
+}
+
+#include "ConcurrentSkipList.cpp"
+
+#endif // CONCURRENTSKIPLIST_HPP
@@ -0,0 +1,105 @@
+#ifndef HAZARDPOINTER_CPP
+#define HAZARDPOINTER_CPP
+
+#include "HazardPointer.hpp"
+#include <algorithm>
+
+namespace ConcurrentVersion {
+    inline HazardPointer::ThreadState& HazardPointer::local() {
+        thread_local ThreadState state;
+        if (!state.record) {
+            state.record = acquireRecord();
+        }
+        return state;
+    }
+
+    inline HazardPointer::Record* HazardPointer::acquireRecord() {
+        // 先复用已退出线程留下的空闲槽位
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            bool expected = false;
+            if (record->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+
+        Record* record = new Record();
+        Record* head = records.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    inline HazardPointer::ThreadState::~ThreadState() {
+        if (record) {
+            record->pointer.store(nullptr, std::memory_order_release);
+        }
+        scan(retired);
+        if (!retired.empty()) {
+            Orphans* batch = new Orphans{std::move(retired), orphans.load(std::memory_order_relaxed)};
+            while (!orphans.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            }
+        }
+        if (record) {
+            record->active.store(false, std::memory_order_release);
+        }
+    }
+
+    inline void HazardPointer::protect(const void* pointer) noexcept {
+        local().record->pointer.store(pointer, std::memory_order_seq_cst);
+    }
+
+    inline void HazardPointer::clear() noexcept {
+        local().record->pointer.store(nullptr, std::memory_order_release);
+    }
+
+    inline void HazardPointer::retire(void* pointer, Deleter deleter) {
+        ThreadState& state = local();
+        state.retired.push_back(Retired{pointer, deleter});
+        if (state.retired.size() >= 2 * recordCount.load(std::memory_order_relaxed) + SCAN_THRESHOLD) {
+            scan(state.retired);
+        }
+    }
+
+    inline void HazardPointer::reclaim() {
+        scan(local().retired);
+    }
+
+    inline size_t HazardPointer::pendingCount() noexcept {
+        return local().retired.size();
+    }
+
+    inline void HazardPointer::scan(std::vector<Retired>& retired) {
+        // 顺带接管已退出线程遗留的节点
+        for (Orphans* batch = orphans.exchange(nullptr, std::memory_order_acquire); batch;) {
+            retired.insert(retired.end(), batch->items.begin(), batch->items.end());
+            Orphans* next = batch->next;
+            delete batch;
+            batch = next;
+        }
+
+        // 与 protect 的 seq_cst 写入配对：节点摘下之前发布、且读者校验通过的保护一定能被看到
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::vector<const void*> hazards;
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            if (const void* pointer = record->pointer.load(std::memory_order_seq_cst)) {
+                hazards.push_back(pointer);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        auto kept = std::partition(retired.begin(), retired.end(), [&hazards](const Retired& item) {
+            return std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(item.pointer));
+        });
+        // 先移出再释放：deleter 中可能再次 retire
+        std::vector<Retired> reclaimable(kept, retired.end());
+        retired.erase(kept, retired.end());
+        for (const Retired& item : reclaimable) {
+            item.deleter(item.pointer);
+        }
+    }
+}
+
+#endif // HAZARDPOINTER_CPP
@@ -0,0 +1,71 @@
+#ifndef HAZARDPOINTER_HPP
+#define HAZARDPOINTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// ============================================================================
+// 危险指针（hazard pointer）：无锁结构的安全内存回收
+// 读者在解引用共享节点前先把节点地址发布到自己的槽位；
+// 节点摘下后不直接 delete，而是 retire 到本线程的待回收列表，
+// 攒够一批后扫描所有槽位，只释放没有被任何线程保护的节点。
+// 每个线程只有一个槽位，适用于同一时刻只需保护一个节点的结构（如 Treiber 栈）。
+// ============================================================================
+namespace ConcurrentVersion {
+    class HazardPointer {
+    public:
+        using Deleter = void (*)(void*);
+
+        // 发布保护（seq_cst：必须先于随后对共享指针的再次读取生效）
+        static void protect(const void* pointer) noexcept;
+        static void clear() noexcept;
+
+        // 节点已从共享结构中摘下：等到没有线程保护它时再调用 deleter
+        static void retire(void* pointer, Deleter deleter);
+        // 立即扫描一次本线程（以及已退出线程遗留）的待回收节点
+        static void reclaim();
+        static size_t pendingCount() noexcept;  // 本线程尚未释放的节点数
+
+    private:
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+        static constexpr size_t SCAN_THRESHOLD = 64;  // 待回收数超过 2 × 槽位数 + 该值时扫描
+
+        // 槽位只增不减：线程退出后标记为空闲，由新线程复用
+        struct alignas(CACHE_LINE_SIZE) Record {
+            std::atomic<const void*> pointer{nullptr};
+            std::atomic<bool> active{true};
+            Record* next = nullptr;
+        };
+
+        struct Retired {
+            void* pointer;
+            Deleter deleter;
+        };
+
+        // 线程退出时仍被保护的节点，交给其他线程以后回收
+        struct Orphans {
+            std::vector<Retired> items;
+            Orphans* next;
+        };
+
+        struct ThreadState {
+            Record* record = nullptr;
+            std::vector<Retired> retired;
+
+            ~ThreadState();
+        };
+
+        static inline std::atomic<Record*> records{nullptr};
+        static inline std::atomic<size_t> recordCount{0};
+        static inline std::atomic<Orphans*> orphans{nullptr};
+
+        static ThreadState& local();
+        static Record* acquireRecord();
+        static void scan(std::vector<Retired>& retired);
+    };
+}
+
+#include "HazardPointer.cpp"
+
+#endif // HAZARDPOINTER_HPP
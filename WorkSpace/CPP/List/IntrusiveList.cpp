@@ -0,0 +1,262 @@
+#ifndef INTRUSIVELIST_CPP
+#define INTRUSIVELIST_CPP
+
+#include "IntrusiveList.hpp"
+#include <stdexcept>
+
+namespace IntrusiveVersion {
+    // ========================================================================
+    // 钩子
+    // ========================================================================
+    template <typename Tag>
+    ListHook<Tag>::~ListHook() {
+        unlink();  // 元素先于链表销毁时自动摘下，避免链表留下悬空指针
+    }
+
+    template <typename Tag>
+    bool ListHook<Tag>::isLinked() const noexcept {
+        return next != nullptr;
+    }
+
+    template <typename Tag>
+    void ListHook<Tag>::unlink() noexcept {
+        if (next) {
+            prev->next = next;
+            next->prev = prev;
+            prev = nullptr;
+            next = nullptr;
+        }
+    }
+
+    // ========================================================================
+    // 链接操作
+    // ========================================================================
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::linkBefore(Hook* position, Hook* hook) {
+#ifndef NDEBUG
+        if (hook->isLinked()) {
+            throw std::logic_error("IntrusiveVersion::LinkedList: element is already linked through this hook");
+        }
+#endif
+        linkRange(position, hook, hook);
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::linkRange(Hook* position, Hook* first, Hook* last) noexcept {
+        Hook* before = position->prev;
+        before->next = first;
+        first->prev = before;
+        last->next = position;
+        position->prev = last;
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::reset() noexcept {
+        root.prev = &root;
+        root.next = &root;
+    }
+
+    // ========================================================================
+    // 构造、析构与移动
+    // ========================================================================
+    template <typename T, typename Tag>
+    LinkedList<T, Tag>::LinkedList() noexcept {
+        reset();
+    }
+
+    template <typename T, typename Tag>
+    LinkedList<T, Tag>::~LinkedList() {
+        clear();
+        root.prev = nullptr;  // 哨兵自身的析构不再做任何事
+        root.next = nullptr;
+    }
+
+    template <typename T, typename Tag>
+    LinkedList<T, Tag>::LinkedList(LinkedList&& other) noexcept {
+        reset();
+        splice(end(), other);
+    }
+
+    template <typename T, typename Tag>
+    LinkedList<T, Tag>& LinkedList<T, Tag>::operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // 两端操作
+    // ========================================================================
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::push_front(T& value) {
+        linkBefore(root.next, &hookOf(value));
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::push_back(T& value) {
+        linkBefore(&root, &hookOf(value));
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::pop_front() {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        root.next->unlink();
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::pop_back() {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        root.prev->unlink();
+    }
+
+    template <typename T, typename Tag>
+    T& LinkedList<T, Tag>::front() {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return valueOf(root.next);
+    }
+
+    template <typename T, typename Tag>
+    const T& LinkedList<T, Tag>::front() const {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return valueOf(root.next);
+    }
+
+    template <typename T, typename Tag>
+    T& LinkedList<T, Tag>::back() {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return valueOf(root.prev);
+    }
+
+    template <typename T, typename Tag>
+    const T& LinkedList<T, Tag>::back() const {
+        if (empty()) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return valueOf(root.prev);
+    }
+
+    // ========================================================================
+    // 任意位置插入、摘下与拼接
+    // ========================================================================
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::iterator LinkedList<T, Tag>::insert(const_iterator pos, T& value) {
+        linkBefore(pos.hook, &hookOf(value));
+        return iterator(&hookOf(value));
+    }
+
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::iterator LinkedList<T, Tag>::erase(const_iterator pos) noexcept {
+        Hook* next = pos.hook->next;
+        pos.hook->unlink();
+        return iterator(next);
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::remove(T& value) noexcept {
+        hookOf(value).unlink();
+    }
+
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::iterator LinkedList<T, Tag>::iterator_to(T& value) noexcept {
+        return iterator(&hookOf(value));
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::splice(const_iterator pos, LinkedList& other) noexcept {
+        if (&other == this || other.empty()) {
+            return;
+        }
+        Hook* first = other.root.next;
+        Hook* last = other.root.prev;
+        other.reset();
+        linkRange(pos.hook, first, last);
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::splice(const_iterator pos, LinkedList& /*other*/, const_iterator it) noexcept {
+        Hook* hook = it.hook;
+        if (hook == pos.hook || hook->next == pos.hook) {
+            return;  // 已经在目标位置
+        }
+        hook->prev->next = hook->next;
+        hook->next->prev = hook->prev;
+        linkRange(pos.hook, hook, hook);
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::splice(const_iterator pos, LinkedList& /*other*/,
+                                    const_iterator first, const_iterator last) noexcept {
+        // 环形链表中摘下一段只需改动两端，不需要知道元素个数；pos 不能位于 [first, last) 内
+        if (first == last) {
+            return;
+        }
+        Hook* head = first.hook;
+        Hook* tail = last.hook->prev;
+        head->prev->next = last.hook;
+        last.hook->prev = head->prev;
+        linkRange(pos.hook, head, tail);
+    }
+
+    template <typename T, typename Tag>
+    void LinkedList<T, Tag>::clear() noexcept {
+        Hook* hook = root.next;
+        while (hook != &root) {
+            Hook* next = hook->next;
+            hook->prev = nullptr;
+            hook->next = nullptr;
+            hook = next;
+        }
+        reset();
+    }
+
+    // ========================================================================
+    // 迭代与状态查询
+    // ========================================================================
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::iterator LinkedList<T, Tag>::begin() noexcept {
+        return iterator(root.next);
+    }
+
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::iterator LinkedList<T, Tag>::end() noexcept {
+        return iterator(&root);
+    }
+
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::const_iterator LinkedList<T, Tag>::begin() const noexcept {
+        return const_iterator(root.next);
+    }
+
+    template <typename T, typename Tag>
+    typename LinkedList<T, Tag>::const_iterator LinkedList<T, Tag>::end() const noexcept {
+        return const_iterator(const_cast<Hook*>(&root));
+    }
+
+    template <typename T, typename Tag>
+    bool LinkedList<T, Tag>::empty() const noexcept {
+        return root.next == &root;
+    }
+
+    template <typename T, typename Tag>
+    size_t LinkedList<T, Tag>::size() const noexcept {
+        size_t count = 0;
+        for (const Hook* hook = root.next; hook != &root; hook = hook->next) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+#endif // INTRUSIVELIST_CPP
@@ -0,0 +1,144 @@
+#ifndef INTRUSIVELIST_HPP
+#define INTRUSIVELIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// ============================================================================
+// 侵入式双向链表：链接字段（钩子）嵌在用户类型里，链表本身从不分配内存
+// 对象继承 ListHook<Tag>，用不同的 Tag 可以同时挂在多条链表上：
+//
+//     struct ReadyTag {};
+//     struct AllTag {};
+//     struct Task : IntrusiveVersion::ListHook<ReadyTag>, IntrusiveVersion::ListHook<AllTag> { ... };
+//     IntrusiveVersion::LinkedList<Task, ReadyTag> ready;
+//     IntrusiveVersion::LinkedList<Task, AllTag> all;
+//
+// 链表不拥有元素：元素的生命周期由调用方（通常是对象池）管理。
+// 元素析构时会自动从所在链表中摘下；调试构建（未定义 NDEBUG）下，
+// 把已在链表中的钩子再次插入会抛出 std::logic_error。
+// ============================================================================
+namespace IntrusiveVersion {
+    struct DefaultTag {};
+
+    template <typename T, typename Tag>
+    class LinkedList;
+
+    template <typename Tag = DefaultTag>
+    class ListHook {
+    private:
+        ListHook* prev;
+        ListHook* next;
+
+        template <typename, typename> friend class LinkedList;
+
+    public:
+        ListHook() noexcept : prev(nullptr), next(nullptr) {}
+        // 拷贝对象不拷贝链接关系：副本总是未链接的
+        ListHook(const ListHook&) noexcept : ListHook() {}
+        ListHook& operator=(const ListHook&) noexcept { return *this; }
+        ~ListHook();
+
+        bool isLinked() const noexcept;
+        // O(1) 从所在链表中摘下（不需要知道是哪条链表），未链接时什么也不做
+        void unlink() noexcept;
+    };
+
+    template <typename T, typename Tag = DefaultTag>
+    class LinkedList {
+    private:
+        using Hook = ListHook<Tag>;
+        static_assert(std::is_base_of_v<Hook, T>, "T must derive from ListHook<Tag>");
+
+        Hook root;  // 哨兵：环形链表的头尾都指向它
+
+        static Hook& hookOf(T& value) noexcept { return static_cast<Hook&>(value); }
+        static T& valueOf(Hook* hook) noexcept { return static_cast<T&>(*hook); }
+        static void linkBefore(Hook* position, Hook* hook);   // 调试构建下检查重复链接
+        static void linkRange(Hook* position, Hook* first, Hook* last) noexcept;  // 把 [first, last] 接到 position 之前
+        void reset() noexcept;
+
+        template <bool Const>
+        class Iterator {
+        private:
+            Hook* hook;
+            friend class LinkedList;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Iterator() noexcept : hook(nullptr) {}
+            explicit Iterator(Hook* h) noexcept : hook(h) {}
+            template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            Iterator(const Iterator<OtherConst>& other) noexcept : hook(other.hook) {}
+
+            reference operator*() const noexcept { return valueOf(hook); }
+            pointer operator->() const noexcept { return &valueOf(hook); }
+
+            Iterator& operator++() noexcept { hook = hook->next; return *this; }
+            Iterator operator++(int) noexcept { Iterator old = *this; hook = hook->next; return old; }
+            Iterator& operator--() noexcept { hook = hook->prev; return *this; }
+            Iterator operator--(int) noexcept { Iterator old = *this; hook = hook->prev; return old; }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.hook == b.hook; }
+            friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a.hook != b.hook; }
+
+            template <bool> friend class Iterator;
+        };
+
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        LinkedList() noexcept;
+        ~LinkedList();  // 摘下所有元素，但不销毁它们
+
+        LinkedList(const LinkedList&) = delete;
+        LinkedList& operator=(const LinkedList&) = delete;
+        // 移动只改动首尾元素的链接，O(1)
+        LinkedList(LinkedList&& other) noexcept;
+        LinkedList& operator=(LinkedList&& other) noexcept;
+
+        void push_front(T& value);
+        void push_back(T& value);
+        // front/back/pop 在链表为空时抛出 std::out_of_range
+        void pop_front();
+        void pop_back();
+        T& front();
+        const T& front() const;
+        T& back();
+        const T& back() const;
+
+        iterator insert(const_iterator pos, T& value);  // 插在 pos 之前
+        iterator erase(const_iterator pos) noexcept;    // 摘下 pos，返回下一个元素
+        static void remove(T& value) noexcept;          // 从所在链表摘下，等同于 hook.unlink()
+        static iterator iterator_to(T& value) noexcept; // 已链接元素对应的迭代器
+
+        // 把 other 的全部元素 / 单个元素 / [first, last) 移到 pos 之前，均为 O(1)
+        void splice(const_iterator pos, LinkedList& other) noexcept;
+        void splice(const_iterator pos, LinkedList& other, const_iterator it) noexcept;
+        void splice(const_iterator pos, LinkedList& other, const_iterator first, const_iterator last) noexcept;
+
+        void clear() noexcept;  // O(n)：逐个重置钩子
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        bool empty() const noexcept;
+        size_t size() const noexcept;  // O(n)：元素可以不经过链表直接摘下，不维护计数
+    };
+}
+
+#include "IntrusiveList.cpp"
+
+#endif // INTRUSIVELIST_HPP
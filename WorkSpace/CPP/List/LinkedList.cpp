@@ -1,4 +1,25 @@
 #include "LinkedList.hpp"
+#include <cstdint>
+#include <new>
+
+// ============================================================================
+// 生命周期日志
+// ============================================================================
+namespace {
+    std::ostream* lifecycleSink = nullptr;
+}
+
+void setLifecycleLog(std::ostream* sink) noexcept {
+    lifecycleSink = sink;
+}
+
+std::ostream* lifecycleLog() noexcept {
+#ifdef LINKEDLIST_DISABLE_LIFECYCLE_LOG
+    return nullptr;
+#else
+    return lifecycleSink;
+#endif
+}
 
 // ============================================================================
 // 旧版本实现
@@ -7,14 +28,25 @@ namespace OldVersion {
     Node::Node(int val) : data(val), next(nullptr) {}
     
     Node::~Node() {
-        std::cout << "  [旧版本] 析构节点: " << data << std::endl;
-        delete next;  // 递归删除下一个节点
+        if (std::ostream* log = lifecycleLog()) {
+            *log << "  [旧版本] 析构节点: " << data << '\n';
+        }
+        // 删除一个节点仍会删除它后面的整条链，但逐个摘下后再删除，栈深度恒定
+        Node* current = next;
+        while (current) {
+            Node* following = current->next;
+            current->next = nullptr;
+            delete current;
+            current = following;
+        }
     }
     
     LinkedList::LinkedList() : head(nullptr) {}
     
     LinkedList::~LinkedList() {
-        std::cout << "[旧版本] 开始销毁链表..." << std::endl;
+        if (std::ostream* log = lifecycleLog()) {
+            *log << "[旧版本] 开始销毁链表..." << '\n';
+        }
         delete head;  // 手动删除
     }
     
@@ -41,24 +73,196 @@ namespace ModernVersion {
     Node::Node(int val) : data(val), next(nullptr) {}
     
     Node::~Node() {
-        std::cout << "  [新版本] 析构节点: " << data << std::endl;
-        // 不需要手动 delete，unique_ptr 自动管理
+        if (std::ostream* log = lifecycleLog()) {
+            *log << "  [新版本] 析构节点: " << data << '\n';
+        }
+        // 不需要手动 delete，但默认的 unique_ptr 链式析构会逐层递归：
+        // 先把后继逐个摘下，每个节点析构时 next 已为空
+        NodePtr current = std::move(next);
+        while (current) {
+            NodePtr following = std::move(current->next);
+            current = std::move(following);
+        }
     }
     
-    LinkedList::LinkedList() : head(nullptr) {}
+    void NodeDeleter::operator()(Node* node) const noexcept {
+        NodePool::destroy(node);
+    }
+    
+    // ------------------------------------------------------------------------
+    // NodePool
+    // ------------------------------------------------------------------------
+    NodePool::NodePool() : slabs(nullptr), freeList(nullptr), live(0), slabTotal(0), detached(false) {}
+    
+    NodePool::~NodePool() {
+        // 整块归还，不逐个释放节点
+        while (slabs) {
+            SlabHeader* next = slabs->next;
+            ::operator delete(slabs, std::align_val_t(SLAB_BYTES));
+            slabs = next;
+        }
+    }
+    
+    std::shared_ptr<NodePool> NodePool::create() {
+        // shared_ptr 的删除器只负责“解除持有”，真正的释放要等弹出的节点全部归还
+        return std::shared_ptr<NodePool>(new NodePool(), [](NodePool* pool) { pool->detach(); });
+    }
+    
+    void NodePool::addSlab() {
+        void* memory = ::operator new(SLAB_BYTES, std::align_val_t(SLAB_BYTES));
+        auto* header = static_cast<SlabHeader*>(memory);
+        header->owner = this;
+        header->next = slabs;
+        slabs = header;
+        ++slabTotal;
+        
+        // 新槽位按地址顺序串进空闲链表，连续 push 得到的节点在内存中也是连续的
+        auto* first = reinterpret_cast<Slot*>(static_cast<unsigned char*>(memory) + FIRST_SLOT_OFFSET);
+        for (size_t i = SLOTS_PER_SLAB; i-- > 0;) {
+            first[i].nextFree = freeList;
+            freeList = &first[i];
+        }
+    }
+    
+    Node* NodePool::allocate(int val) {
+        if (!freeList) {
+            addSlab();
+        }
+        Slot* slot = freeList;
+        freeList = slot->nextFree;
+        Node* node = new (slot->storage) Node(val);
+        ++live;
+        return node;
+    }
+    
+    void NodePool::destroy(Node* node) noexcept {
+        if (!node) {
+            return;
+        }
+        // slab 按 SLAB_BYTES 对齐：抹掉低位就是 slab 头部
+        const auto address = reinterpret_cast<std::uintptr_t>(node);
+        auto* header = reinterpret_cast<SlabHeader*>(address & ~(std::uintptr_t{SLAB_BYTES} - 1));
+        NodePool* owner = header->owner;
+        node->~Node();
+        owner->deallocate(reinterpret_cast<Slot*>(node));
+    }
+    
+    void NodePool::deallocate(Slot* slot) noexcept {
+        slot->nextFree = freeList;
+        freeList = slot;
+        --live;
+        releaseIfUnused();
+    }
+    
+    void NodePool::detach() noexcept {
+        detached = true;
+        releaseIfUnused();
+    }
+    
+    void NodePool::releaseIfUnused() noexcept {
+        if (detached && live == 0) {
+            delete this;
+        }
+    }
+    
+    size_t NodePool::liveCount() const noexcept {
+        return live;
+    }
+    
+    size_t NodePool::slabCount() const noexcept {
+        return slabTotal;
+    }
+    
+    // ------------------------------------------------------------------------
+    // LinkedList
+    // ------------------------------------------------------------------------
+    namespace {
+        // 合并两条升序链，相等时 a 中的节点在前（保证排序稳定）
+        // mergedTail 非空时写入合并结果的尾节点：最后整段接上的是哪条链的剩余部分，尾节点就是那条链的尾节点
+        // （aTail / bTail），与输入是否真的有序无关
+        NodePtr mergeSorted(NodePtr a, NodePtr b, Node* aTail = nullptr, Node* bTail = nullptr,
+                            Node** mergedTail = nullptr) noexcept {
+            NodePtr result;
+            NodePtr* link = &result;
+            Node* last = nullptr;
+            while (a && b) {
+                NodePtr& source = (b->data < a->data) ? b : a;
+                *link = std::move(source);
+                source = std::move((*link)->next);
+                last = link->get();
+                link = &last->next;
+            }
+            if (mergedTail) {
+                *mergedTail = a ? aTail : (b ? bTail : last);
+            }
+            *link = a ? std::move(a) : std::move(b);
+            return result;
+        }
+    }
+    
+    LinkedList::LinkedList() : head(nullptr), tail(nullptr), pool(NodePool::create()) {}
+    
+    LinkedList::LinkedList(std::shared_ptr<NodePool> sharedPool)
+        : head(nullptr), tail(nullptr), pool(sharedPool ? std::move(sharedPool) : NodePool::create()) {}
+    
+    LinkedList::LinkedList(std::initializer_list<int> values) : LinkedList(values.begin(), values.end()) {}
+    
+    LinkedList::LinkedList(LinkedList&& other) noexcept
+        : head(std::move(other.head)), tail(other.tail), pool(std::move(other.pool)) {
+        other.tail = nullptr;
+    }
     
     LinkedList::~LinkedList() {
-        std::cout << "[新版本] 开始销毁链表..." << std::endl;
-        // unique_ptr 自动释放，无需手动 delete
+        if (std::ostream* log = lifecycleLog()) {
+            *log << "[新版本] 开始销毁链表..." << '\n';
+        }
+        clear();
+        // pool 随后释放：没有其他持有者时整块归还所有 slab
+    }
+    
+    LinkedList& LinkedList::operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = std::move(other.head);
+            tail = other.tail;
+            pool = std::move(other.pool);
+            other.tail = nullptr;
+        }
+        return *this;
+    }
+    
+    void LinkedList::ensurePool() {
+        if (!pool) {
+            pool = NodePool::create();  // 被移动过的链表重新获得一个池
+        }
+    }
+    
+    void LinkedList::resetTail() noexcept {
+        tail = head.get();
+        while (tail && tail->next) {
+            tail = tail->next.get();
+        }
     }
     
     void LinkedList::push_front(int val) {
-        // 使用 std::make_unique（C++14）创建节点
-        auto newNode = std::make_unique<Node>(val);
+        ensurePool();
+        // 节点从池中分配，而不是每个元素单独 new
+        NodePtr newNode(pool->allocate(val));
         
         // 使用移动语义转移所有权
         newNode->next = std::move(head);
         head = std::move(newNode);
+        if (!tail) {
+            tail = head.get();
+        }
+    }
+    
+    void LinkedList::push_back(int val) {
+        ensurePool();
+        NodePtr newNode(pool->allocate(val));
+        Node* raw = newNode.get();
+        (tail ? tail->next : head) = std::move(newNode);
+        tail = raw;
     }
     
     void LinkedList::print() const {
@@ -70,12 +274,131 @@ namespace ModernVersion {
         std::cout << "nullptr" << std::endl;
     }
     
-    std::unique_ptr<Node> LinkedList::pop_front() {
+    NodePtr LinkedList::pop_front() {
         if (!head) return nullptr;
         
         auto oldHead = std::move(head);  // 转移所有权
         head = std::move(oldHead->next);
-        return oldHead;  // 返回被移除的节点
+        if (!head) {
+            tail = nullptr;
+        }
+        return oldHead;  // 返回被移除的节点，销毁时槽位回到池中
+    }
+    
+    void LinkedList::clear() noexcept {
+        head.reset();  // Node 的析构函数以循环方式释放后续节点
+        tail = nullptr;
+    }
+    
+    void LinkedList::sort() noexcept {
+        // 先把每 RUN 个节点在栈上的指针数组里插入排序成一段有序链，
+        // 再逐级归并：bins[i] 为空或是一条由 2^i 段组成的有序链，越靠后的 bin 装的是越早摘下的节点
+        constexpr size_t RUN = 16;
+        NodePtr bins[64];
+        size_t used = 0;
+        NodePtr rest = std::move(head);
+        while (rest) {
+            Node* run[RUN];
+            size_t count = 0;
+            while (rest && count < RUN) {
+                NodePtr node = std::move(rest);
+                rest = std::move(node->next);
+                Node* raw = node.release();
+                size_t j = count++;
+                for (; j > 0 && raw->data < run[j - 1]->data; --j) {  // 严格小于才后移，保持稳定
+                    run[j] = run[j - 1];
+                }
+                run[j] = raw;
+            }
+            NodePtr carry;
+            for (size_t j = count; j-- > 0;) {
+                NodePtr node(run[j]);
+                node->next = std::move(carry);
+                carry = std::move(node);
+            }
+            
+            size_t i = 0;
+            for (; i < used && bins[i]; ++i) {
+                carry = mergeSorted(std::move(bins[i]), std::move(carry));
+            }
+            if (i == used) {
+                ++used;
+            }
+            bins[i] = std::move(carry);
+        }
+        
+        NodePtr result;
+        for (size_t i = 0; i < used; ++i) {
+            result = mergeSorted(std::move(bins[i]), std::move(result));
+        }
+        head = std::move(result);
+        resetTail();
+    }
+    
+    void LinkedList::merge(LinkedList& other) noexcept {
+        if (this == &other || !other.head) {
+            return;
+        }
+        head = mergeSorted(std::move(head), std::move(other.head), tail, other.tail, &tail);
+        other.tail = nullptr;
+    }
+    
+    void LinkedList::splice(LinkedList& other) noexcept {
+        if (this == &other || !other.head) {
+            return;
+        }
+        // 节点仍归还给各自的池，跨池拼接也是安全的
+        (tail ? tail->next : head) = std::move(other.head);
+        tail = other.tail;
+        other.tail = nullptr;
+    }
+    
+    void LinkedList::splice_front(LinkedList& other) noexcept {
+        if (this == &other || !other.head) {
+            return;
+        }
+        other.tail->next = std::move(head);
+        if (!tail) {
+            tail = other.tail;
+        }
+        head = std::move(other.head);
+        other.tail = nullptr;
+    }
+    
+    void LinkedList::reverse() noexcept {
+        NodePtr reversed;
+        NodePtr current = std::move(head);
+        tail = current.get();
+        while (current) {
+            NodePtr next = std::move(current->next);
+            current->next = std::move(reversed);
+            reversed = std::move(current);
+            current = std::move(next);
+        }
+        head = std::move(reversed);
+    }
+    
+    size_t LinkedList::unique() noexcept {
+        size_t removed = 0;
+        Node* current = head.get();
+        while (current && current->next) {
+            if (current->next->data == current->data) {
+                NodePtr doomed = std::move(current->next);
+                current->next = std::move(doomed->next);
+                ++removed;
+            } else {
+                current = current->next.get();
+            }
+        }
+        tail = current;
+        return removed;
+    }
+    
+    const Node* LinkedList::getHead() const noexcept {
+        return head.get();
+    }
+    
+    const std::shared_ptr<NodePool>& LinkedList::getPool() const noexcept {
+        return pool;
     }
 }
-
@@ -1,9 +1,19 @@
 #ifndef LINKEDLIST_HPP
 #define LINKEDLIST_HPP
 
+#include <cstddef>
+#include <initializer_list>
 #include <memory>
 #include <iostream>
 
+// ============================================================================
+// 生命周期日志（节点/链表析构）
+// 默认不输出；调用 setLifecycleLog(&std::cout) 后写入指定的流（不逐行 flush）。
+// 编译时定义 LINKEDLIST_DISABLE_LIFECYCLE_LOG 可把日志代码完全去掉。
+// ============================================================================
+void setLifecycleLog(std::ostream* sink) noexcept;
+std::ostream* lifecycleLog() noexcept;
+
 // ============================================================================
 // 旧版本：使用原始指针
 // ============================================================================
@@ -37,20 +47,87 @@ namespace OldVersion {
 // 新版本：使用 std::unique_ptr
 // ============================================================================
 namespace ModernVersion {
+    struct Node;
+    
+    // 把节点归还给它所在的 slab 池：删除器本身无状态，
+    // 由节点地址找到 slab 头部记录的池，因此 NodePtr 与原始指针一样大
+    struct NodeDeleter {
+        void operator()(Node* node) const noexcept;
+    };
+    using NodePtr = std::unique_ptr<Node, NodeDeleter>;
+    
     struct Node {
         int data;
-        std::unique_ptr<Node> next;
+        NodePtr next;
         
         Node(int val);
         ~Node();
     };
     
+    // 节点 slab 池：按 SLAB_BYTES 对齐整块分配，空闲槽位串成单链表
+    // pop_front 弹出的节点销毁时槽位回到空闲链表，链表销毁时整块释放 slab。
+    // 池通过 shared_ptr 持有，可由多个小链表共享（非线程安全，只能在同一线程内共享）；
+    // 最后一个持有者释放后，池会等到所有弹出的节点都归还后再释放。
+    class NodePool {
+    public:
+        static constexpr size_t SLAB_BYTES = 4096;
+        
+        static std::shared_ptr<NodePool> create();
+        
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        
+        Node* allocate(int val);               // 取一个空闲槽位并构造节点
+        static void destroy(Node* node) noexcept;  // 析构节点并归还给所属的池
+        
+        size_t liveCount() const noexcept;     // 尚未归还的节点数
+        size_t slabCount() const noexcept;
+        
+    private:
+        struct SlabHeader {
+            NodePool* owner;
+            SlabHeader* next;
+        };
+        union Slot {
+            Slot* nextFree;
+            alignas(Node) unsigned char storage[sizeof(Node)];
+        };
+        static constexpr size_t FIRST_SLOT_OFFSET =
+            (sizeof(SlabHeader) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+        static constexpr size_t SLOTS_PER_SLAB = (SLAB_BYTES - FIRST_SLOT_OFFSET) / sizeof(Slot);
+        
+        SlabHeader* slabs;
+        Slot* freeList;
+        size_t live;
+        size_t slabTotal;
+        bool detached;  // 已没有 shared_ptr 持有者
+        
+        NodePool();
+        ~NodePool();
+        
+        void addSlab();
+        void deallocate(Slot* slot) noexcept;
+        void detach() noexcept;
+        void releaseIfUnused() noexcept;
+    };
+    
     class LinkedList {
     private:
-        std::unique_ptr<Node> head;
+        NodePtr head;
+        Node* tail;  // 缓存的尾节点（不拥有），push_back / splice 为 O(1)
+        std::shared_ptr<NodePool> pool;
+        
+        void ensurePool();
+        void resetTail() noexcept;  // 重新走一遍链表找到尾节点
         
     public:
         LinkedList();
+        // 与其他链表共享同一个节点池（适合大量小链表）
+        explicit LinkedList(std::shared_ptr<NodePool> sharedPool);
+        // 从区间 [first, last) 按顺序构造
+        template <typename InputIt>
+        LinkedList(InputIt first, InputIt last, std::shared_ptr<NodePool> sharedPool = nullptr);
+        LinkedList(std::initializer_list<int> values);
         ~LinkedList();
         
         // 禁止拷贝
@@ -58,13 +135,55 @@ namespace ModernVersion {
         LinkedList& operator=(const LinkedList&) = delete;
         
         // 支持移动语义
-        LinkedList(LinkedList&&) = default;
-        LinkedList& operator=(LinkedList&&) = default;
+        LinkedList(LinkedList&& other) noexcept;
+        LinkedList& operator=(LinkedList&& other) noexcept;
         
         void push_front(int val);
+        void push_back(int val);
         void print() const;
-        std::unique_ptr<Node> pop_front();
+        NodePtr pop_front();
+        void clear() noexcept;
+        
+        // 以下算法只重新链接已有节点：不分配内存、不递归
+        void sort() noexcept;                     // 自底向上归并排序（稳定，升序）
+        void merge(LinkedList& other) noexcept;   // 两个升序链表合并到本链表，other 变为空
+        void splice(LinkedList& other) noexcept;  // 把 other 整条接到末尾，O(1)
+        void splice_front(LinkedList& other) noexcept;  // 把 other 整条接到开头，O(1)
+        void reverse() noexcept;
+        template <typename Predicate>
+        size_t remove_if(Predicate pred);         // 返回删除的节点数
+        size_t unique() noexcept;                 // 删除相邻的重复元素，返回删除的节点数
+        
+        const Node* getHead() const noexcept;  // 只读遍历的起点
+        const std::shared_ptr<NodePool>& getPool() const noexcept;
     };
+    
+    template <typename InputIt>
+    LinkedList::LinkedList(InputIt first, InputIt last, std::shared_ptr<NodePool> sharedPool)
+        : LinkedList(std::move(sharedPool)) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+    
+    template <typename Predicate>
+    size_t LinkedList::remove_if(Predicate pred) {
+        size_t removed = 0;
+        NodePtr* link = &head;  // 指向当前节点的所有者
+        Node* last = nullptr;
+        while (*link) {
+            if (pred((*link)->data)) {
+                NodePtr doomed = std::move(*link);
+                *link = std::move(doomed->next);  // doomed 析构时 next 已为空
+                ++removed;
+            } else {
+                last = link->get();
+                link = &last->next;
+            }
+        }
+        tail = last;
+        return removed;
+    }
 }
 
 #endif // LINKEDLIST_HPP
@@ -0,0 +1,135 @@
+#ifndef LOCKFREESTACK_CPP
+#define LOCKFREESTACK_CPP
+
+#include "LockFreeStack.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace ConcurrentVersion {
+    template <typename T>
+    typename LockFreeStack<T>::Node* LockFreeStack<T>::pointerOf(uint64_t tagged) noexcept {
+        return reinterpret_cast<Node*>(static_cast<uintptr_t>(tagged & POINTER_MASK));
+    }
+
+    template <typename T>
+    uint64_t LockFreeStack<T>::pack(Node* node, uint64_t previous) noexcept {
+        const uint64_t tag = (previous >> TAG_SHIFT) + 1;  // 溢出时自然回绕
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(node)) | (tag << TAG_SHIFT);
+    }
+
+    template <typename T>
+    void LockFreeStack<T>::deleteNode(void* node) noexcept {
+        delete static_cast<Node*>(node);
+    }
+
+    template <typename T>
+    LockFreeStack<T>::LockFreeStack() noexcept : head(0) {}
+
+    template <typename T>
+    LockFreeStack<T>::~LockFreeStack() {
+        Node* node = pointerOf(head.load(std::memory_order_acquire));
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    template <typename T>
+    void LockFreeStack<T>::push(const T& value) {
+        emplace(value);
+    }
+
+    template <typename T>
+    void LockFreeStack<T>::push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void LockFreeStack<T>::emplace(Args&&... args) {
+        Node* node = new Node(std::forward<Args>(args)...);
+        if (reinterpret_cast<uintptr_t>(node) & ~POINTER_MASK) {
+            delete node;
+            throw std::runtime_error("LockFreeStack node address does not fit in 48 bits");
+        }
+
+        uint64_t current = head.load(std::memory_order_relaxed);
+        do {
+            node->next = pointerOf(current);
+        } while (!head.compare_exchange_weak(current, pack(node, current),
+                                             std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    template <typename T>
+    std::optional<T> LockFreeStack<T>::pop() {
+        uint64_t current = head.load(std::memory_order_acquire);
+        for (;;) {
+            Node* node = pointerOf(current);
+            if (!node) {
+                HazardPointer::clear();
+                return std::nullopt;
+            }
+
+            // 保护之后再确认 head 未变：此后 node 不会在我们读取 next 时被释放
+            HazardPointer::protect(node);
+            const uint64_t check = head.load(std::memory_order_seq_cst);
+            if (check != current) {
+                current = check;
+                continue;
+            }
+
+            if (head.compare_exchange_weak(current, pack(node->next, current),
+                                           std::memory_order_acquire, std::memory_order_acquire)) {
+                HazardPointer::clear();
+                std::optional<T> value;
+                try {
+                    value.emplace(std::move(node->value));
+                } catch (...) {
+                    HazardPointer::retire(node, &deleteNode);
+                    throw;
+                }
+                HazardPointer::retire(node, &deleteNode);
+                return value;
+            }
+        }
+    }
+
+    template <typename T>
+    template <typename F>
+    size_t LockFreeStack<T>::pop_all(F&& f) {
+        uint64_t current = head.load(std::memory_order_relaxed);
+        while (pointerOf(current) &&
+               !head.compare_exchange_weak(current, pack(nullptr, current),
+                                           std::memory_order_acquire, std::memory_order_relaxed)) {
+        }
+
+        // 链上的节点可能仍被并发 pop 的线程保护着（它们的 CAS 注定失败），同样只能 retire
+        size_t count = 0;
+        Node* node = pointerOf(current);
+        try {
+            while (node) {
+                Node* next = node->next;
+                f(std::move(node->value));
+                HazardPointer::retire(node, &deleteNode);
+                node = next;
+                ++count;
+            }
+        } catch (...) {
+            while (node) {
+                Node* next = node->next;
+                HazardPointer::retire(node, &deleteNode);
+                node = next;
+            }
+            throw;
+        }
+        return count;
+    }
+
+    template <typename T>
+    bool LockFreeStack<T>::isEmpty() const noexcept {
+        return pointerOf(head.load(std::memory_order_acquire)) == nullptr;
+    }
+}
+
+#endif // LOCKFREESTACK_CPP
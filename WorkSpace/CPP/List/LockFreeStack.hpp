@@ -0,0 +1,69 @@
+#ifndef LOCKFREESTACK_HPP
+#define LOCKFREESTACK_HPP
+
+#include "HazardPointer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+// ============================================================================
+// 无锁栈（Treiber 栈）：ModernVersion::LinkedList 的 push_front / pop_front 的线程安全版本
+// - head 是带标签的指针：低 48 位为节点地址，高 16 位为修改计数，
+//   每次修改 head 都加一，即使节点地址被复用，基于旧快照的 CAS 也会失败（ABA 防护）
+// - pop 在读取 head->next 之前用危险指针保护 head，摘下的节点经 HazardPointer::retire 延迟释放
+// - pop_all 一次 CAS 取走整条链，适合批量交接任务、整体回收空闲链表
+// ============================================================================
+namespace ConcurrentVersion {
+    template <typename T>
+    class LockFreeStack {
+        static_assert(sizeof(void*) == 8, "LockFreeStack packs a 16-bit tag into 64-bit pointers");
+
+    private:
+        struct Node {
+            T value;
+            Node* next;  // 发布之后不再修改
+
+            template <typename... Args>
+            explicit Node(Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+        };
+
+        static constexpr unsigned TAG_SHIFT = 48;
+        static constexpr uint64_t POINTER_MASK = (uint64_t{1} << TAG_SHIFT) - 1;
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;
+
+        static Node* pointerOf(uint64_t tagged) noexcept;
+        static uint64_t pack(Node* node, uint64_t previous) noexcept;  // 标签取 previous 的标签加一
+        static void deleteNode(void* node) noexcept;
+
+    public:
+        LockFreeStack() noexcept;
+        // 析构时不能再有其他线程访问；已 retire 的节点仍由危险指针回收
+        ~LockFreeStack();
+
+        LockFreeStack(const LockFreeStack&) = delete;
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+        void push(const T& value);
+        void push(T&& value);
+        template <typename... Args>
+        void emplace(Args&&... args);
+
+        // 栈为空时返回 std::nullopt
+        std::optional<T> pop();
+
+        // 一次取走整条链，按出栈顺序（后进先出）对每个元素调用 f(T&&)，返回元素个数
+        template <typename F>
+        size_t pop_all(F&& f);
+
+        // 并发时为近似值
+        bool isEmpty() const noexcept;
+    };
+}
+
+#include "LockFreeStack.cpp"
+
+#endif // LOCKFREESTACK_HPP
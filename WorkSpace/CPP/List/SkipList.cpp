@@ -0,0 +1,292 @@
+#ifndef SKIPLIST_CPP
+#define SKIPLIST_CPP
+
+#include "SkipList.hpp"
+#include <new>
+#include <utility>
+
+namespace OrderedVersion {
+    // ========================================================================
+    // 节点
+    // ========================================================================
+    template <typename Key, typename Compare>
+    SkipList<Key, Compare>::Node::~Node() {
+        // 与 ModernVersion::Node 相同：逐个摘下后继，避免 unique_ptr 链式析构的递归
+        NodePtr current = std::move(next);
+        while (current) {
+            NodePtr following = std::move(current->next);
+            current = std::move(following);
+        }
+    }
+
+    template <typename Key, typename Compare>
+    void SkipList<Key, Compare>::NodeDeleter::operator()(Node* node) const noexcept {
+        SkipListArena* owner = SkipListArena::ownerOf(node);
+        const size_t h = node->height;
+        node->~Node();
+        owner->deallocate(node, h);
+    }
+
+    // ========================================================================
+    // 构造、析构与移动
+    // ========================================================================
+    template <typename Key, typename Compare>
+    SkipList<Key, Compare>::SkipList(Compare compare)
+        : arena(nullptr), first(nullptr), heads{}, height(1), count(0), rng(0x9E3779B97F4A7C15ull),
+          comp(std::move(compare)) {
+        ensureArena();
+    }
+
+    template <typename Key, typename Compare>
+    SkipList<Key, Compare>::~SkipList() {
+        clear();
+    }
+
+    template <typename Key, typename Compare>
+    SkipList<Key, Compare>::SkipList(SkipList&& other) noexcept
+        : arena(std::move(other.arena)), first(std::move(other.first)), height(other.height),
+          count(other.count), rng(other.rng), comp(other.comp) {
+        for (size_t level = 0; level < MAX_HEIGHT; ++level) {
+            heads[level] = other.heads[level];
+            other.heads[level] = nullptr;
+        }
+        other.height = 1;
+        other.count = 0;
+    }
+
+    template <typename Key, typename Compare>
+    SkipList<Key, Compare>& SkipList<Key, Compare>::operator=(SkipList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            first = std::move(other.first);  // 先交出节点，再替换 arena
+            arena = std::move(other.arena);
+            for (size_t level = 0; level < MAX_HEIGHT; ++level) {
+                heads[level] = other.heads[level];
+                other.heads[level] = nullptr;
+            }
+            height = other.height;
+            count = other.count;
+            rng = other.rng;
+            comp = other.comp;
+            other.height = 1;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    template <typename Key, typename Compare>
+    void SkipList<Key, Compare>::ensureArena() {
+        if (!arena) {
+            // 高度为 h 的节点占 sizeof(Node) + (h - 1) 个指针
+            arena = std::make_unique<SkipListArena>(sizeof(Node) - sizeof(Node*), sizeof(Node*));
+        }
+    }
+
+    // ========================================================================
+    // 查找路径
+    // ========================================================================
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::Node* SkipList<Key, Compare>::forwardOf(Node* pred, size_t level) const noexcept {
+        if (pred) {
+            return pred->forward(level);
+        }
+        return level == 0 ? first.get() : heads[level];
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::Node*& SkipList<Key, Compare>::upperLink(Node* pred, size_t level) noexcept {
+        return pred ? pred->upper()[level - 1] : heads[level];
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::NodePtr& SkipList<Key, Compare>::ownerLink(Node* pred) noexcept {
+        return pred ? pred->next : first;
+    }
+
+    template <typename Key, typename Compare>
+    void SkipList<Key, Compare>::findPredecessors(const Key& key, Node** preds) const {
+        Node* x = nullptr;
+        for (size_t level = height; level-- > 0;) {
+            for (Node* n = forwardOf(x, level); n && comp(n->key, key); n = forwardOf(x, level)) {
+                x = n;
+            }
+            preds[level] = x;
+        }
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::Node* SkipList<Key, Compare>::lowerBoundNode(const Key& key) const {
+        Node* x = nullptr;
+        for (size_t level = height; level-- > 0;) {
+            for (Node* n = forwardOf(x, level); n && comp(n->key, key); n = forwardOf(x, level)) {
+                x = n;
+            }
+        }
+        return forwardOf(x, 0);
+    }
+
+    template <typename Key, typename Compare>
+    size_t SkipList<Key, Compare>::randomHeight() noexcept {
+        size_t h = 1;
+        while (h < MAX_HEIGHT) {
+            // xorshift64
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            if (rng % BRANCHING != 0) {
+                break;
+            }
+            ++h;
+        }
+        return h;
+    }
+
+    // ========================================================================
+    // 插入与删除
+    // ========================================================================
+    template <typename Key, typename Compare>
+    bool SkipList<Key, Compare>::insert(const Key& key) {
+        Node* preds[MAX_HEIGHT];
+        findPredecessors(key, preds);
+        Node* candidate = forwardOf(preds[0], 0);
+        if (candidate && !comp(key, candidate->key)) {
+            return false;
+        }
+
+        ensureArena();
+        const size_t h = randomHeight();
+        void* memory = arena->allocate(h);
+        Node* raw;
+        try {
+            raw = new (memory) Node(key, static_cast<uint32_t>(h));
+        } catch (...) {
+            arena->deallocate(memory, h);
+            throw;
+        }
+        NodePtr node(raw);
+
+        for (size_t level = height; level < h; ++level) {
+            preds[level] = nullptr;  // 新增的层从头结点开始
+        }
+        if (h > height) {
+            height = h;
+        }
+        for (size_t level = 1; level < h; ++level) {
+            Node*& link = upperLink(preds[level], level);
+            raw->upper()[level - 1] = link;
+            link = raw;
+        }
+        NodePtr& owner = ownerLink(preds[0]);
+        node->next = std::move(owner);
+        owner = std::move(node);
+        ++count;
+        return true;
+    }
+
+    template <typename Key, typename Compare>
+    bool SkipList<Key, Compare>::erase(const Key& key) {
+        Node* preds[MAX_HEIGHT];
+        findPredecessors(key, preds);
+        Node* target = forwardOf(preds[0], 0);
+        if (!target || comp(key, target->key)) {
+            return false;
+        }
+
+        for (size_t level = 1; level < target->height; ++level) {
+            upperLink(preds[level], level) = target->upper()[level - 1];
+        }
+        NodePtr& owner = ownerLink(preds[0]);
+        NodePtr doomed = std::move(owner);
+        owner = std::move(doomed->next);  // doomed 析构时 next 已为空，节点回到 arena
+        doomed.reset();
+
+        while (height > 1 && !heads[height - 1]) {
+            --height;
+        }
+        --count;
+        return true;
+    }
+
+    template <typename Key, typename Compare>
+    void SkipList<Key, Compare>::clear() noexcept {
+        first.reset();  // Node 的析构函数以循环方式释放后续节点
+        for (Node*& head : heads) {
+            head = nullptr;
+        }
+        height = 1;
+        count = 0;
+    }
+
+    // ========================================================================
+    // 查询与遍历
+    // ========================================================================
+    template <typename Key, typename Compare>
+    bool SkipList<Key, Compare>::contains(const Key& key) const {
+        return find(key) != end();
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::const_iterator SkipList<Key, Compare>::find(const Key& key) const {
+        Node* node = lowerBoundNode(key);
+        return (node && !comp(key, node->key)) ? const_iterator(node) : end();
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::const_iterator SkipList<Key, Compare>::lower_bound(const Key& key) const {
+        return const_iterator(lowerBoundNode(key));
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::const_iterator SkipList<Key, Compare>::upper_bound(const Key& key) const {
+        Node* x = nullptr;
+        for (size_t level = height; level-- > 0;) {
+            for (Node* n = forwardOf(x, level); n && !comp(key, n->key); n = forwardOf(x, level)) {
+                x = n;
+            }
+        }
+        return const_iterator(forwardOf(x, 0));
+    }
+
+    template <typename Key, typename Compare>
+    template <typename F>
+    size_t SkipList<Key, Compare>::for_each_in_range(const Key& low, const Key& high, F&& f) const {
+        size_t visited = 0;
+        for (const Node* node = lowerBoundNode(low); node && comp(node->key, high); node = node->next.get()) {
+            f(node->key);
+            ++visited;
+        }
+        return visited;
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::const_iterator SkipList<Key, Compare>::begin() const noexcept {
+        return const_iterator(first.get());
+    }
+
+    template <typename Key, typename Compare>
+    typename SkipList<Key, Compare>::const_iterator SkipList<Key, Compare>::end() const noexcept {
+        return const_iterator();
+    }
+
+    template <typename Key, typename Compare>
+    bool SkipList<Key, Compare>::empty() const noexcept {
+        return count == 0;
+    }
+
+    template <typename Key, typename Compare>
+    size_t SkipList<Key, Compare>::size() const noexcept {
+        return count;
+    }
+
+    template <typename Key, typename Compare>
+    size_t SkipList<Key, Compare>::levels() const noexcept {
+        return height;
+    }
+
+    template <typename Key, typename Compare>
+    size_t SkipList<Key, Compare>::arenaChunks() const noexcept {
+        return arena ? arena->chunkCount() : 0;
+    }
+}
+
+#endif // SKIPLIST_CPP
@@ -0,0 +1,129 @@
+#ifndef SKIPLIST_HPP
+#define SKIPLIST_HPP
+
+#include "SkipListArena.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+// ============================================================================
+// 跳表有序集合（键唯一）：查找、插入、删除期望 O(log n)，支持按序遍历和区间查询
+// 沿用 ModernVersion::LinkedList 的节点设计：第 0 层的 next 是拥有后继的 unique_ptr，
+// 更高层只是不拥有的捷径指针，紧跟在节点后面，与节点一起从 SkipListArena 分配。
+// ============================================================================
+namespace OrderedVersion {
+    template <typename Key, typename Compare = std::less<Key>>
+    class SkipList {
+        static_assert(alignof(Key) <= alignof(std::max_align_t), "over-aligned keys are not supported");
+
+    public:
+        static constexpr size_t MAX_HEIGHT = SkipListArena::MAX_HEIGHT;
+        static constexpr unsigned BRANCHING = 4;  // 每升高一层，节点数期望减为 1/4
+
+    private:
+        struct Node;
+
+        // 与 ModernVersion::NodeDeleter 相同：由节点地址找到所属 arena，删除器无状态
+        struct NodeDeleter {
+            void operator()(Node* node) const noexcept;
+        };
+        using NodePtr = std::unique_ptr<Node, NodeDeleter>;
+
+        struct Node {
+            Key key;
+            NodePtr next;     // 第 0 层：拥有后继节点
+            uint32_t height;  // 塔高（含第 0 层）
+
+            Node(const Key& k, uint32_t h) : key(k), next(nullptr), height(h) {}
+            ~Node();  // 循环释放后继，栈深度恒定
+
+            // 第 1..height-1 层的指针紧跟在节点之后
+            Node** upper() noexcept {
+                return reinterpret_cast<Node**>(reinterpret_cast<unsigned char*>(this) + sizeof(Node));
+            }
+            Node* forward(size_t level) noexcept { return level == 0 ? next.get() : upper()[level - 1]; }
+        };
+
+        std::unique_ptr<SkipListArena> arena;  // 先于节点声明：节点全部释放后才销毁
+        NodePtr first;                         // 头结点第 0 层
+        Node* heads[MAX_HEIGHT];               // 头结点第 1 层以上（heads[0] 不使用）
+        size_t height;                         // 当前最高层数
+        size_t count;
+        uint64_t rng;
+        Compare comp;
+
+        // pred 为空表示头结点
+        Node* forwardOf(Node* pred, size_t level) const noexcept;
+        Node*& upperLink(Node* pred, size_t level) noexcept;
+        NodePtr& ownerLink(Node* pred) noexcept;
+        // 各层中最后一个小于 key 的节点
+        void findPredecessors(const Key& key, Node** preds) const;
+        Node* lowerBoundNode(const Key& key) const;
+        size_t randomHeight() noexcept;
+        void ensureArena();
+
+    public:
+        // 只读前向迭代器：键不能原地修改
+        class const_iterator {
+        private:
+            const Node* node;
+            friend class SkipList;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Key;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Key*;
+            using reference = const Key&;
+
+            const_iterator() noexcept : node(nullptr) {}
+            explicit const_iterator(const Node* n) noexcept : node(n) {}
+
+            reference operator*() const noexcept { return node->key; }
+            pointer operator->() const noexcept { return &node->key; }
+            const_iterator& operator++() noexcept { node = node->next.get(); return *this; }
+            const_iterator operator++(int) noexcept { const_iterator old = *this; node = node->next.get(); return old; }
+
+            friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept { return a.node == b.node; }
+            friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept { return a.node != b.node; }
+        };
+        using iterator = const_iterator;
+
+        explicit SkipList(Compare compare = Compare());
+        ~SkipList();
+
+        // 禁止拷贝，支持移动
+        SkipList(const SkipList&) = delete;
+        SkipList& operator=(const SkipList&) = delete;
+        SkipList(SkipList&& other) noexcept;
+        SkipList& operator=(SkipList&& other) noexcept;
+
+        // 键已存在时返回 false
+        bool insert(const Key& key);
+        // 键不存在时返回 false
+        bool erase(const Key& key);
+        bool contains(const Key& key) const;
+        const_iterator find(const Key& key) const;
+        const_iterator lower_bound(const Key& key) const;  // 第一个不小于 key 的元素
+        const_iterator upper_bound(const Key& key) const;  // 第一个大于 key 的元素
+        // 依次对 [low, high) 中的元素调用 f(const Key&)，返回元素个数
+        template <typename F>
+        size_t for_each_in_range(const Key& low, const Key& high, F&& f) const;
+
+        void clear() noexcept;
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        bool empty() const noexcept;
+        size_t size() const noexcept;
+        size_t levels() const noexcept;       // 当前层数
+        size_t arenaChunks() const noexcept;  // arena 已分配的块数
+    };
+}
+
+#include "SkipList.cpp"
+
+#endif // SKIPLIST_HPP
@@ -0,0 +1,79 @@
+#ifndef SKIPLISTARENA_CPP
+#define SKIPLISTARENA_CPP
+
+#include "SkipListArena.hpp"
+#include <new>
+#include <stdexcept>
+
+namespace OrderedVersion {
+    inline SkipListArena::SkipListArena(size_t header, size_t level) noexcept
+        : headerBytes(header), levelBytes(level), chunks(nullptr), cursor(nullptr), limit(nullptr),
+          freeLists{}, chunkTotal(0), live(0) {}
+
+    inline SkipListArena::~SkipListArena() {
+        while (chunks) {
+            ChunkHeader* next = chunks->next;
+            ::operator delete(chunks, std::align_val_t(CHUNK_BYTES));
+            chunks = next;
+        }
+    }
+
+    inline void SkipListArena::addChunk() {
+        void* memory = ::operator new(CHUNK_BYTES, std::align_val_t(CHUNK_BYTES));
+        auto* header = static_cast<ChunkHeader*>(memory);
+        header->owner = this;
+        header->next = chunks;
+        chunks = header;
+        ++chunkTotal;
+
+        cursor = static_cast<unsigned char*>(memory) + alignUp(sizeof(ChunkHeader));
+        limit = static_cast<unsigned char*>(memory) + CHUNK_BYTES;
+    }
+
+    inline size_t SkipListArena::nodeBytes(size_t height) const noexcept {
+        return alignUp(headerBytes + height * levelBytes);
+    }
+
+    inline void* SkipListArena::allocate(size_t height) {
+        if (height == 0 || height > MAX_HEIGHT) {
+            throw std::invalid_argument("SkipListArena height out of range");
+        }
+        void* node;
+        if (FreeSlot* slot = freeLists[height]) {
+            freeLists[height] = slot->next;
+            node = slot;
+        } else {
+            const size_t bytes = nodeBytes(height);
+            if (!cursor || static_cast<size_t>(limit - cursor) < bytes) {
+                addChunk();  // 块尾不够放下的部分直接丢弃
+            }
+            node = cursor;
+            cursor += bytes;
+        }
+        ++live;
+        return node;
+    }
+
+    inline void SkipListArena::deallocate(void* node, size_t height) noexcept {
+        auto* slot = static_cast<FreeSlot*>(node);
+        slot->next = freeLists[height];
+        freeLists[height] = slot;
+        --live;
+    }
+
+    inline SkipListArena* SkipListArena::ownerOf(const void* node) noexcept {
+        // 块按 CHUNK_BYTES 对齐：抹掉低位就是块头部
+        const auto address = reinterpret_cast<std::uintptr_t>(node);
+        return reinterpret_cast<ChunkHeader*>(address & ~(std::uintptr_t{CHUNK_BYTES} - 1))->owner;
+    }
+
+    inline size_t SkipListArena::chunkCount() const noexcept {
+        return chunkTotal;
+    }
+
+    inline size_t SkipListArena::liveCount() const noexcept {
+        return live;
+    }
+}
+
+#endif // SKIPLISTARENA_CPP
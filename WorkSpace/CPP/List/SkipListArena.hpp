@@ -0,0 +1,63 @@
+#ifndef SKIPLISTARENA_HPP
+#define SKIPLISTARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// ============================================================================
+// 跳表节点的 arena：节点头部和整座“塔”（各层的 next 指针）放在同一块连续内存里，
+// 从按 CHUNK_BYTES 对齐的大块中顺序切分，释放的节点按高度挂到对应的空闲链表上复用。
+// 与 ModernVersion::NodePool 相同，抹掉节点地址的低位即可找到所属 arena，
+// 因此节点的删除器可以是无状态的。非线程安全。
+// ============================================================================
+namespace OrderedVersion {
+    class SkipListArena {
+    public:
+        static constexpr size_t CHUNK_BYTES = 64 * 1024;
+        static constexpr size_t MAX_HEIGHT = 16;
+
+        // 高度为 h 的节点占 headerBytes + h × levelBytes 字节（向上取整到 alignof(std::max_align_t)）
+        SkipListArena(size_t headerBytes, size_t levelBytes) noexcept;
+        ~SkipListArena();  // 整块归还，不逐个释放节点
+
+        SkipListArena(const SkipListArena&) = delete;
+        SkipListArena& operator=(const SkipListArena&) = delete;
+
+        void* allocate(size_t height);  // 返回未初始化的内存
+        void deallocate(void* node, size_t height) noexcept;
+        static SkipListArena* ownerOf(const void* node) noexcept;
+
+        size_t nodeBytes(size_t height) const noexcept;
+        size_t chunkCount() const noexcept;
+        size_t liveCount() const noexcept;
+
+    private:
+        struct ChunkHeader {
+            SkipListArena* owner;
+            ChunkHeader* next;
+        };
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+        size_t headerBytes;
+        size_t levelBytes;
+        ChunkHeader* chunks;
+        unsigned char* cursor;  // 当前块中尚未切分的部分
+        unsigned char* limit;
+        FreeSlot* freeLists[MAX_HEIGHT + 1];
+        size_t chunkTotal;
+        size_t live;
+
+        static constexpr size_t alignUp(size_t bytes) noexcept {
+            return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+        void addChunk();
+    };
+}
+
+#include "SkipListArena.cpp"
+
+#endif // SKIPLISTARENA_HPP
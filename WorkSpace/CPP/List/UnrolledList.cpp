@@ -0,0 +1,455 @@
+#ifndef UNROLLEDLIST_CPP
+#define UNROLLEDLIST_CPP
+
+#include "UnrolledList.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace UnrolledVersion {
+    // ========================================================================
+    // 节点内部的元素搬移（T 的移动构造不会抛出异常）
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::Node::~Node() {
+        for (size_t i = begin; i < end; ++i) {
+            slot(i)->~T();
+        }
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::Node::moveElement(size_t from, Node& target, size_t to) noexcept {
+        T* source = slot(from);
+        ::new (target.raw(to)) T(std::move(*source));
+        source->~T();
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::Node::alignFront() noexcept {
+        const size_t n = count();
+        for (size_t i = 0; i < n; ++i) {  // 向低地址搬，从前往后不会覆盖未搬的元素
+            moveElement(begin + i, i);
+        }
+        begin = 0;
+        end = static_cast<uint32_t>(n);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::Node::alignBack() noexcept {
+        const size_t n = count();
+        const size_t first = NODE_CAPACITY - n;
+        for (size_t i = n; i-- > 0;) {  // 向高地址搬，从后往前
+            moveElement(begin + i, first + i);
+        }
+        begin = static_cast<uint32_t>(first);
+        end = static_cast<uint32_t>(NODE_CAPACITY);
+    }
+
+    // ========================================================================
+    // 构造、析构与赋值
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::LinkedList() noexcept : tail(nullptr), length(0) {}
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::LinkedList(std::initializer_list<T> values) : LinkedList() {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::~LinkedList() {
+        clear();
+    }
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::LinkedList(const LinkedList& other) : LinkedList() {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>& LinkedList<T, NodeBytes>::operator=(const LinkedList& other) {
+        if (this != &other) {
+            LinkedList copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>::LinkedList(LinkedList&& other) noexcept
+        : head(std::move(other.head)), tail(other.tail), length(other.length) {
+        other.tail = nullptr;
+        other.length = 0;
+    }
+
+    template <typename T, size_t NodeBytes>
+    LinkedList<T, NodeBytes>& LinkedList<T, NodeBytes>::operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = std::move(other.head);
+            tail = other.tail;
+            length = other.length;
+            other.tail = nullptr;
+            other.length = 0;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // 节点的链接与拆分、合并
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::Node* LinkedList<T, NodeBytes>::insertNodeAfter(Node* node, uint32_t first) {
+        auto fresh = std::make_unique<Node>(first);
+        Node* raw = fresh.get();
+        std::unique_ptr<Node>& link = node ? node->next : head;
+        fresh->prev = node;
+        fresh->next = std::move(link);
+        if (fresh->next) {
+            fresh->next->prev = raw;
+        } else {
+            tail = raw;
+        }
+        link = std::move(fresh);
+        return raw;
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::unlinkNode(Node* node) noexcept {
+        Node* prev = node->prev;
+        std::unique_ptr<Node> following = std::move(node->next);
+        if (following) {
+            following->prev = prev;
+        } else {
+            tail = prev;
+        }
+        // 覆盖持有者时销毁 node，此时它的 next 已为空，不会连带释放后续节点
+        (prev ? prev->next : head) = std::move(following);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::splitNode(Node* node, size_t keep) {
+        Node* right = insertNodeAfter(node, 0);  // 唯一可能抛出异常的一步，发生在搬移之前
+        const size_t moved = node->count() - keep;
+        for (size_t i = 0; i < moved; ++i) {
+            node->moveElement(node->begin + keep + i, *right, i);
+        }
+        right->end = static_cast<uint32_t>(moved);
+        node->end = static_cast<uint32_t>(node->begin + keep);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::rebalance(Node* node) noexcept {
+        constexpr size_t HALF = NODE_CAPACITY / 2;
+        Node* next = node->next.get();
+        if (!next || node->count() >= HALF) {
+            return;
+        }
+
+        node->alignFront();
+        if (node->count() + next->count() <= NODE_CAPACITY) {
+            // 后继整体并入当前节点
+            while (next->begin < next->end) {
+                next->moveElement(next->begin++, *node, node->end++);
+            }
+            unlinkNode(next);
+        } else {
+            // 后继元素较多：借入若干个，使当前节点恢复半满，后继仍然超过半满
+            while (node->count() < HALF) {
+                next->moveElement(next->begin++, *node, node->end++);
+            }
+        }
+    }
+
+    // ========================================================================
+    // 两端操作
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T, size_t NodeBytes>
+    template <typename... Args>
+    T& LinkedList<T, NodeBytes>::emplace_front(Args&&... args) {
+        Node* node = head.get();
+        if (node && node->begin == 0 && !node->full()) {
+            // 整理节点会移动已有元素，而参数可能引用其中之一（如 push_front(front())）：
+            // 与 emplace 相同，先构造临时对象，再整理并移入（移动构造不抛异常）
+            T value(std::forward<Args>(args)...);
+            node->alignBack();
+            ::new (node->raw(node->begin - 1)) T(std::move(value));
+            --node->begin;
+            ++length;
+            return *node->slot(node->begin);
+        }
+        if (!node || node->begin == 0) {
+            node = insertNodeAfter(nullptr, static_cast<uint32_t>(NODE_CAPACITY));
+        }
+
+        try {
+            ::new (node->raw(node->begin - 1)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (node->count() == 0) {
+                unlinkNode(node);  // 不保留空节点
+            }
+            throw;
+        }
+        --node->begin;
+        ++length;
+        return *node->slot(node->begin);
+    }
+
+    template <typename T, size_t NodeBytes>
+    template <typename... Args>
+    T& LinkedList<T, NodeBytes>::emplace_back(Args&&... args) {
+        Node* node = tail;
+        if (node && node->end == NODE_CAPACITY && !node->full()) {
+            // 参数可能引用尾节点中的元素（如 push_back(back())），见 emplace_front
+            T value(std::forward<Args>(args)...);
+            node->alignFront();
+            ::new (node->raw(node->end)) T(std::move(value));
+            ++length;
+            return *node->slot(node->end++);
+        }
+        if (!node || node->end == NODE_CAPACITY) {
+            node = insertNodeAfter(tail, 0);
+        }
+
+        try {
+            ::new (node->raw(node->end)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (node->count() == 0) {
+                unlinkNode(node);
+            }
+            throw;
+        }
+        ++length;
+        return *node->slot(node->end++);
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::pop_front() {
+        if (!head) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        Node* node = head.get();
+        node->slot(node->begin++)->~T();
+        --length;
+        if (node->count() == 0) {
+            unlinkNode(node);
+        }
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::pop_back() {
+        if (!tail) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        Node* node = tail;
+        node->slot(--node->end)->~T();
+        --length;
+        if (node->count() == 0) {
+            unlinkNode(node);
+        }
+    }
+
+    template <typename T, size_t NodeBytes>
+    T& LinkedList<T, NodeBytes>::front() {
+        if (!head) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return *head->slot(head->begin);
+    }
+
+    template <typename T, size_t NodeBytes>
+    const T& LinkedList<T, NodeBytes>::front() const {
+        if (!head) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return *head->slot(head->begin);
+    }
+
+    template <typename T, size_t NodeBytes>
+    T& LinkedList<T, NodeBytes>::back() {
+        if (!tail) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return *tail->slot(tail->end - 1);
+    }
+
+    template <typename T, size_t NodeBytes>
+    const T& LinkedList<T, NodeBytes>::back() const {
+        if (!tail) {
+            throw std::out_of_range("LinkedList is empty");
+        }
+        return *tail->slot(tail->end - 1);
+    }
+
+    // ========================================================================
+    // 任意位置插入、删除（会使指向同一节点及其后继节点的迭代器失效）
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename T, size_t NodeBytes>
+    template <typename... Args>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::emplace(const_iterator pos, Args&&... args) {
+        if (!pos.node) {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail, tail->end - 1);
+        }
+
+        // 先构造好新元素，之后的搬移和拆分都不会让链表处于半完成状态
+        T value(std::forward<Args>(args)...);
+        Node* node = const_cast<Node*>(pos.node);
+        size_t offset = pos.index - node->begin;  // 在节点内的逻辑位置
+
+        if (node->full()) {
+            const size_t keep = node->count() / 2;
+            splitNode(node, keep);
+            if (offset > keep) {
+                node = node->next.get();
+                offset -= keep;
+            }
+        }
+
+        size_t at = node->begin + offset;
+        if (node->end < NODE_CAPACITY) {
+            // 后半部分右移一格
+            for (size_t i = node->end; i > at; --i) {
+                node->moveElement(i - 1, i);
+            }
+            ++node->end;
+        } else {
+            // 尾部已经顶到容量上限，前半部分左移一格
+            for (size_t i = node->begin; i < at; ++i) {
+                node->moveElement(i, i - 1);
+            }
+            --node->begin;
+            --at;
+        }
+        ::new (node->raw(at)) T(std::move(value));
+        ++length;
+        return iterator(node, at);
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::erase(const_iterator pos) {
+        if (!pos.node) {
+            throw std::out_of_range("LinkedList::erase called with end()");
+        }
+        Node* node = const_cast<Node*>(pos.node);
+        const size_t offset = pos.index - node->begin;
+
+        node->slot(pos.index)->~T();
+        for (size_t i = pos.index + 1; i < node->end; ++i) {
+            node->moveElement(i, i - 1);
+        }
+        --node->end;
+        --length;
+
+        if (node->count() == 0) {
+            Node* next = node->next.get();
+            unlinkNode(node);
+            return next ? iterator(next, next->begin) : end();
+        }
+
+        rebalance(node);
+        if (offset < node->count()) {
+            return iterator(node, node->begin + offset);
+        }
+        Node* next = node->next.get();
+        return next ? iterator(next, next->begin) : end();
+    }
+
+    template <typename T, size_t NodeBytes>
+    void LinkedList<T, NodeBytes>::clear() noexcept {
+        std::unique_ptr<Node> current = std::move(head);
+        while (current) {
+            std::unique_ptr<Node> next = std::move(current->next);
+            current = std::move(next);
+        }
+        tail = nullptr;
+        length = 0;
+    }
+
+    // ========================================================================
+    // 迭代与状态查询
+    // ========================================================================
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::begin() noexcept {
+        return head ? iterator(head.get(), head->begin) : end();
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::iterator LinkedList<T, NodeBytes>::end() noexcept {
+        return iterator();
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::const_iterator LinkedList<T, NodeBytes>::begin() const noexcept {
+        return head ? const_iterator(head.get(), head->begin) : end();
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::const_iterator LinkedList<T, NodeBytes>::end() const noexcept {
+        return const_iterator();
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::const_iterator LinkedList<T, NodeBytes>::cbegin() const noexcept {
+        return begin();
+    }
+
+    template <typename T, size_t NodeBytes>
+    typename LinkedList<T, NodeBytes>::const_iterator LinkedList<T, NodeBytes>::cend() const noexcept {
+        return end();
+    }
+
+    template <typename T, size_t NodeBytes>
+    bool LinkedList<T, NodeBytes>::empty() const noexcept {
+        return length == 0;
+    }
+
+    template <typename T, size_t NodeBytes>
+    size_t LinkedList<T, NodeBytes>::size() const noexcept {
+        return length;
+    }
+
+    template <typename T, size_t NodeBytes>
+    size_t LinkedList<T, NodeBytes>::nodeCount() const noexcept {
+        size_t count = 0;
+        for (const Node* node = head.get(); node; node = node->next.get()) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+#endif // UNROLLEDLIST_CPP
@@ -0,0 +1,174 @@
+#ifndef UNROLLEDLIST_HPP
+#define UNROLLEDLIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// ============================================================================
+// 展开链表（unrolled linked list）：每个节点存放一小段连续元素
+// 节点大小按缓存行对齐（默认 NodeBytes = 128，即两条缓存行），
+// 遍历时每个节点只需一次指针跳转，其余元素都在同一块连续内存中。
+// ============================================================================
+namespace UnrolledVersion {
+    template <typename T, size_t NodeBytes = 128>
+    class LinkedList {
+    private:
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+        static constexpr size_t HEADER_BYTES = 2 * sizeof(void*) + 2 * sizeof(uint32_t);
+
+        static_assert(NodeBytes % CACHE_LINE_SIZE == 0, "NodeBytes must be a multiple of the cache line size");
+        // 拆分、合并时元素要在槽位和节点之间移动，移动不能中途失败
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+                      "UnrolledVersion::LinkedList requires a nothrow move constructor");
+
+    public:
+        // 每个节点的元素个数：元素过大时退化为每节点一个元素
+        static constexpr size_t NODE_CAPACITY =
+            NodeBytes > HEADER_BYTES && (NodeBytes - HEADER_BYTES) / sizeof(T) > 0
+                ? (NodeBytes - HEADER_BYTES) / sizeof(T)
+                : 1;
+
+    private:
+        // 元素存放在 [begin, end) 槽位中：头节点从后往前填（push_front 为 O(1)），
+        // 尾节点从前往后填（push_back 为 O(1)）
+        struct alignas(CACHE_LINE_SIZE) Node {
+            std::unique_ptr<Node> next;
+            Node* prev = nullptr;
+            uint32_t begin = 0;
+            uint32_t end = 0;
+            alignas(T) unsigned char storage[NODE_CAPACITY * sizeof(T)];
+
+            Node(uint32_t first) noexcept : begin(first), end(first) {}
+            ~Node();
+
+            void* raw(size_t index) noexcept { return storage + index * sizeof(T); }  // 构造新元素的位置
+            T* slot(size_t index) noexcept { return std::launder(reinterpret_cast<T*>(storage) + index); }
+            const T* slot(size_t index) const noexcept {
+                return std::launder(reinterpret_cast<const T*>(storage) + index);
+            }
+            size_t count() const noexcept { return end - begin; }
+            bool full() const noexcept { return count() == NODE_CAPACITY; }
+            void moveElement(size_t from, Node& target, size_t to) noexcept;  // to 必须是空槽位
+            void moveElement(size_t from, size_t to) noexcept { moveElement(from, *this, to); }
+            void alignFront() noexcept;  // 把元素移到 [0, count)，为 push_back 腾出尾部
+            void alignBack() noexcept;   // 把元素移到 [CAPACITY - count, CAPACITY)，为 push_front 腾出头部
+        };
+
+        std::unique_ptr<Node> head;
+        Node* tail;
+        size_t length;
+
+        Node* insertNodeAfter(Node* node, uint32_t first);  // node 为空时插在最前面
+        void unlinkNode(Node* node) noexcept;
+        void splitNode(Node* node, size_t keep);  // 把满节点 keep 之后的元素移到新的后继节点
+        void rebalance(Node* node) noexcept;      // 删除后节点不足半满时与后继合并或借入元素
+
+        template <bool Const>
+        class Iterator {
+        private:
+            using NodeType = std::conditional_t<Const, const Node, Node>;
+            NodeType* node;
+            size_t index;  // node 中的槽位下标
+            friend class LinkedList;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Iterator() noexcept : node(nullptr), index(0) {}
+            Iterator(NodeType* n, size_t i) noexcept : node(n), index(i) {}
+            // iterator 可隐式转换为 const_iterator
+            template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            Iterator(const Iterator<OtherConst>& other) noexcept : node(other.node), index(other.index) {}
+
+            reference operator*() const noexcept { return *node->slot(index); }
+            pointer operator->() const noexcept { return node->slot(index); }
+
+            Iterator& operator++() noexcept {
+                if (++index == node->end) {
+                    node = node->next.get();
+                    index = node ? node->begin : 0;
+                }
+                return *this;
+            }
+            Iterator operator++(int) noexcept {
+                Iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+                return a.node == b.node && a.index == b.index;
+            }
+            friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return !(a == b); }
+
+            template <bool> friend class Iterator;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        LinkedList() noexcept;
+        LinkedList(std::initializer_list<T> values);
+        ~LinkedList();
+
+        LinkedList(const LinkedList& other);
+        LinkedList& operator=(const LinkedList& other);
+        LinkedList(LinkedList&& other) noexcept;
+        LinkedList& operator=(LinkedList&& other) noexcept;
+
+        // 两端操作均为 O(1)；front/back/pop 在链表为空时抛出 std::out_of_range
+        void push_front(const T& value);
+        void push_front(T&& value);
+        void push_back(const T& value);
+        void push_back(T&& value);
+        template <typename... Args>
+        T& emplace_front(Args&&... args);
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
+        void pop_front();
+        void pop_back();
+        T& front();
+        const T& front() const;
+        T& back();
+        const T& back() const;
+
+        // 在 pos 之前插入：所在节点已满时先拆分成两个半满节点
+        iterator insert(const_iterator pos, const T& value);
+        iterator insert(const_iterator pos, T&& value);
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args);
+        // 删除 pos 处的元素，返回下一个元素；节点不足半满时与后继合并
+        iterator erase(const_iterator pos);
+
+        void clear() noexcept;  // 逐个节点循环释放，栈深度恒定
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        bool empty() const noexcept;
+        size_t size() const noexcept;
+        size_t nodeCount() const noexcept;  // 当前节点个数（用于观察拆分/合并）
+    };
+}
+
+#include "UnrolledList.cpp"
+
+#endif // UNROLLEDLIST_HPP
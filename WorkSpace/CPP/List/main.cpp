@@ -1,5 +1,21 @@
 #include "LinkedList.hpp"
+#include "UnrolledList.hpp"
+#include "LockFreeStack.hpp"
+#include "IntrusiveList.hpp"
+#include "SkipList.hpp"
+#include "ConcurrentSkipList.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <iostream>
+#include <list>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 // ============================================================================
 // 演示和对比
@@ -57,7 +73,865 @@ void demonstrateMoveSemantics() {
     std::cout << "\n离开作用域：" << std::endl;
 }
 
+void demonstrateNodePool() {
+    std::cout << "\n========== 演示节点池（slab 分配） ==========\n" << std::endl;
+    
+    // 多个小链表共享同一个池：节点挤在同一块 slab 里，而不是各自 new
+    auto pool = ModernVersion::NodePool::create();
+    ModernVersion::LinkedList list1(pool);
+    ModernVersion::LinkedList list2(pool);
+    list1.push_front(1);
+    list2.push_front(100);
+    list2.push_front(200);
+    
+    std::cout << "list1: ";
+    list1.print();
+    std::cout << "list2: ";
+    list2.print();
+    std::cout << "池中存活节点: " << pool->liveCount()
+              << "，slab 数: " << pool->slabCount() << std::endl;
+    
+    // 弹出的节点销毁时，槽位回到池的空闲链表
+    list2.pop_front();
+    std::cout << "pop_front 后存活节点: " << pool->liveCount() << std::endl;
+    
+    std::cout << "\n离开作用域：" << std::endl;
+}
+
+void demonstrateUnrolledList() {
+    std::cout << "\n========== 演示展开链表（每个节点存放多个元素） ==========\n" << std::endl;
+    
+    using List = UnrolledVersion::LinkedList<int>;
+    std::cout << "每个节点最多存放 " << List::NODE_CAPACITY << " 个 int" << std::endl;
+    
+    List list;
+    for (int i = 0; i < 60; ++i) {
+        list.push_back(i);
+    }
+    list.push_front(-1);
+    std::cout << "元素个数: " << list.size() << "，节点数: " << list.nodeCount() << std::endl;
+    
+    // 在满节点中间插入会把它拆成两个半满节点
+    auto pos = list.begin();
+    for (int i = 0; i < 10; ++i) {
+        ++pos;
+    }
+    list.insert(pos, 1000);
+    std::cout << "insert 后节点数: " << list.nodeCount() << std::endl;
+    
+    // 删除到不足半满时与后继节点合并
+    while (list.size() > 20) {
+        list.erase(list.begin());
+    }
+    std::cout << "erase 后元素个数: " << list.size() << "，节点数: " << list.nodeCount() << std::endl;
+    
+    long long sum = 0;
+    for (int value : list) {
+        sum += value;
+    }
+    std::cout << "剩余元素之和: " << sum << std::endl;
+}
+
+void demonstrateLockFreeStack() {
+    std::cout << "\n========== 演示无锁栈（多线程 push / pop） ==========\n" << std::endl;
+    
+    ConcurrentVersion::LockFreeStack<int> stack;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&stack, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                stack.push(t * 1000 + i);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    
+    auto top = stack.pop();
+    std::cout << "pop 得到: " << (top ? *top : -1) << std::endl;
+    
+    // pop_all 一次取走整条链
+    long long sum = 0;
+    size_t count = stack.pop_all([&sum](int&& value) { sum += value; });
+    std::cout << "pop_all 取走 " << count << " 个元素，之和: " << sum
+              << "，栈是否为空: " << (stack.isEmpty() ? "是" : "否") << std::endl;
+}
+
+void demonstrateListAlgorithms() {
+    std::cout << "\n========== 演示原地算法（只重新链接节点） ==========\n" << std::endl;
+    
+    ModernVersion::LinkedList list{5, 3, 8, 3, 1, 8, 2};
+    std::cout << "原始链表: ";
+    list.print();
+    
+    list.sort();
+    std::cout << "sort 后: ";
+    list.print();
+    
+    size_t removed = list.unique();
+    std::cout << "unique 删除 " << removed << " 个: ";
+    list.print();
+    
+    ModernVersion::LinkedList other{4, 6, 9};
+    list.merge(other);
+    std::cout << "merge {4, 6, 9} 后: ";
+    list.print();
+    
+    list.remove_if([](int value) { return value % 2 == 0; });
+    std::cout << "remove_if(偶数) 后: ";
+    list.print();
+    
+    list.reverse();
+    list.push_back(0);
+    std::cout << "reverse + push_back(0) 后: ";
+    list.print();
+}
+
+// 同时挂在两条侵入式链表上的对象：钩子嵌在对象内部
+struct ReadyTag {};
+struct AllTag {};
+struct Job : IntrusiveVersion::ListHook<ReadyTag>, IntrusiveVersion::ListHook<AllTag> {
+    int id;
+    explicit Job(int i) : id(i) {}
+};
+
+void demonstrateIntrusiveList() {
+    std::cout << "\n========== 演示侵入式链表（不分配节点） ==========\n" << std::endl;
+    
+    std::vector<Job> jobs;  // 对象本身由调用方的容器/对象池持有
+    for (int i = 1; i <= 5; ++i) {
+        jobs.emplace_back(i);
+    }
+    
+    IntrusiveVersion::LinkedList<Job, AllTag> all;
+    IntrusiveVersion::LinkedList<Job, ReadyTag> ready;
+    for (Job& job : jobs) {
+        all.push_back(job);
+        if (job.id % 2 == 1) {
+            ready.push_front(job);
+        }
+    }
+    
+    auto show = [](const char* name, const auto& list) {
+        std::cout << name << ": ";
+        for (const Job& job : list) {
+            std::cout << job.id << " ";
+        }
+        std::cout << std::endl;
+    };
+    show("all  ", all);
+    show("ready", ready);
+    
+    // O(1) 从任意位置摘下：只影响 ready 链表
+    static_cast<IntrusiveVersion::ListHook<ReadyTag>&>(jobs[2]).unlink();
+    show("摘下 3 后 ready", ready);
+    
+    // splice：把 ready 整条接到另一条链表末尾，不移动任何对象
+    IntrusiveVersion::LinkedList<Job, ReadyTag> running;
+    running.splice(running.end(), ready);
+    show("running", running);
+    std::cout << "ready 是否为空: " << (ready.empty() ? "是" : "否") << std::endl;
+}
+
+void demonstrateSkipList() {
+    std::cout << "\n========== 演示跳表（有序集合与区间查询） ==========\n" << std::endl;
+    
+    OrderedVersion::SkipList<int> index;
+    for (int value : {42, 7, 19, 3, 88, 19, 56, 23}) {
+        index.insert(value);  // 重复的 19 被忽略
+    }
+    std::cout << "有序遍历: ";
+    for (int value : index) {
+        std::cout << value << " ";
+    }
+    std::cout << "\n元素个数: " << index.size() << "，层数: " << index.levels() << std::endl;
+    
+    std::cout << "区间 [10, 60): ";
+    index.for_each_in_range(10, 60, [](int value) { std::cout << value << " "; });
+    std::cout << std::endl;
+    
+    index.erase(19);
+    auto it = index.lower_bound(19);
+    std::cout << "删除 19 后 lower_bound(19) = " << (it != index.end() ? *it : -1) << std::endl;
+    
+    // 并发版本：一个写线程插入，读线程不加锁地查询
+    ConcurrentVersion::ConcurrentSkipList<int> shared;
+    std::thread writer([&shared]() {
+        for (int i = 0; i < 1000; ++i) {
+            shared.insert(i * 2);
+        }
+    });
+    std::thread reader([&shared]() {
+        // 偶数键是否已插入取决于线程调度，奇数键则一定查不到
+        for (int i = 0; i < 1000; ++i) {
+            assert(!shared.contains(i * 2 + 1));
+        }
+    });
+    writer.join();
+    reader.join();
+    
+    size_t inRange = shared.for_each_in_range(100, 200, [](int) {});
+    std::cout << "并发跳表元素个数: " << shared.size() << "，区间 [100, 200) 内: " << inRange << std::endl;
+}
+
+// ============================================================================
+// 自测：与标准容器逐步对照，结果不一致时 assert 失败
+// ============================================================================
+std::vector<int> toVector(const ModernVersion::LinkedList& list) {
+    std::vector<int> values;
+    for (const ModernVersion::Node* node = list.getHead(); node; node = node->next.get()) {
+        values.push_back(node->data);
+    }
+    return values;
+}
+
+bool sameElements(const ModernVersion::LinkedList& list, const std::list<int>& reference) {
+    const std::vector<int> values = toVector(list);
+    return std::equal(values.begin(), values.end(), reference.begin(), reference.end());
+}
+
+void testNodePool() {
+    std::cout << "=== 测试节点池（所有权与槽位复用） ===" << std::endl;
+    using ModernVersion::LinkedList;
+    using ModernVersion::NodePool;
+    
+    // 共享池：清空后的槽位被另一条链表复用，不再新增 slab
+    {
+        auto pool = NodePool::create();
+        LinkedList a(pool);
+        LinkedList b(pool);
+        for (int i = 0; i < 1000; ++i) {
+            a.push_back(i);
+        }
+        const size_t slabs = pool->slabCount();
+        assert(pool->liveCount() == 1000 && slabs > 1);
+        a.clear();
+        assert(pool->liveCount() == 0 && pool->slabCount() == slabs);
+        for (int i = 0; i < 1000; ++i) {
+            b.push_front(i);
+        }
+        assert(pool->liveCount() == 1000 && pool->slabCount() == slabs);
+        {
+            auto node = b.pop_front();
+            assert(node && node->data == 999 && pool->liveCount() == 1000);
+        }
+        assert(pool->liveCount() == 999);
+        a.push_back(-1);  // 刚归还的槽位
+        assert(pool->liveCount() == 1000 && pool->slabCount() == slabs);
+    }
+    std::cout << "✓ 共享池复用槽位（liveCount / slabCount）" << std::endl;
+    
+    // 弹出的节点比链表和池的所有持有者活得更久：池等它归还后才释放
+    {
+        ModernVersion::NodePtr survivor;
+        {
+            LinkedList list{1, 2, 3};
+            survivor = list.pop_front();
+        }
+        assert(survivor && survivor->data == 1 && !survivor->next);
+        survivor->data = 10;  // 槽位仍然有效
+        assert(survivor->data == 10);
+        survivor.reset();  // 最后一个节点归还，池随之释放
+    }
+    std::cout << "✓ 弹出的节点在链表和池销毁后仍然有效" << std::endl;
+    
+    // 跨池 splice / merge：节点仍属于原来的池，源链表销毁后照常使用和归还
+    {
+        std::shared_ptr<NodePool> sourcePool;
+        LinkedList target{1, 5, 9};
+        const std::shared_ptr<NodePool> targetPool = target.getPool();
+        {
+            LinkedList source{2, 6};
+            LinkedList front{0};
+            sourcePool = source.getPool();
+            target.merge(source);
+            target.splice_front(front);
+            assert(!source.getHead() && !front.getHead());
+        }
+        assert(toVector(target) == (std::vector<int>{0, 1, 2, 5, 6, 9}));
+        assert(sourcePool->liveCount() == 2 && targetPool->liveCount() == 3);
+        {
+            LinkedList tail{20, 30};
+            target.splice(tail);
+        }
+        target.push_back(40);  // 尾节点来自已销毁链表的池
+        assert(toVector(target) == (std::vector<int>{0, 1, 2, 5, 6, 9, 20, 30, 40}));
+        assert(targetPool->liveCount() == 4);
+        auto first = target.pop_front();  // 节点 0 来自已销毁链表 front 的池
+        assert(first->data == 0);
+        first.reset();
+        target.remove_if([](int value) { return value == 2; });
+        assert(sourcePool->liveCount() == 1);
+        sourcePool.reset();  // 池只剩节点 6 持有，随 target 销毁释放
+    }
+    std::cout << "✓ 跨池 splice / merge 后销毁源链表" << std::endl;
+    
+    // 移动赋值：旧节点归还给原来的池，目标改用来源的池
+    {
+        LinkedList a{1, 2, 3};
+        LinkedList b{7, 8};
+        const std::shared_ptr<NodePool> poolA = a.getPool();
+        const std::shared_ptr<NodePool> poolB = b.getPool();
+        a = std::move(b);
+        assert(poolA->liveCount() == 0 && poolB->liveCount() == 2);
+        assert(a.getPool() == poolB && toVector(a) == (std::vector<int>{7, 8}));
+        a.push_back(9);
+        assert(poolB->liveCount() == 3 && poolA->liveCount() == 0);
+        
+        // 被移走的链表重新获得一个池
+        assert(!b.getHead());
+        b.push_back(4);
+        assert(b.getPool() && b.getPool() != poolA && b.getPool() != poolB);
+        assert(toVector(b) == (std::vector<int>{4}));
+        
+        LinkedList c(poolA);
+        c.push_back(5);
+        a = std::move(c);  // a 的节点归还给 poolB，poolA 的节点随之转移
+        assert(poolB->liveCount() == 0 && poolA->liveCount() == 1);
+        assert(a.getPool() == poolA && toVector(a) == (std::vector<int>{5}));
+    }
+    std::cout << "✓ 移动赋值一个使用不同池的链表" << std::endl;
+}
+
+void testListAlgorithms() {
+    std::cout << "=== 测试原地算法（对照 std::list） ===" << std::endl;
+    
+    std::mt19937 rng(7);
+    auto randomValues = [&rng](size_t n, int range) {
+        std::vector<int> values(n);
+        for (int& value : values) {
+            value = static_cast<int>(rng() % static_cast<unsigned>(range));
+        }
+        return values;
+    };
+    
+    ModernVersion::LinkedList list;
+    std::list<int> reference;
+    for (int step = 0; step < 20000; ++step) {
+        const int value = static_cast<int>(rng() % 100);
+        switch (rng() % 11) {
+        case 0: list.push_front(value); reference.push_front(value); break;
+        case 1: list.push_back(value); reference.push_back(value); break;
+        case 2:
+            assert(static_cast<bool>(list.pop_front()) == !reference.empty());
+            if (!reference.empty()) {
+                reference.pop_front();
+            }
+            break;
+        case 3: list.sort(); reference.sort(); break;
+        case 4: {
+            // merge 的前提是两条链都有序
+            std::vector<int> values = randomValues(rng() % 20, 100);
+            std::stable_sort(values.begin(), values.end());
+            list.sort();
+            reference.sort();
+            ModernVersion::LinkedList other(values.begin(), values.end());
+            std::list<int> otherReference(values.begin(), values.end());
+            list.merge(other);
+            reference.merge(otherReference);
+            assert(!other.getHead());
+            break;
+        }
+        case 5: {
+            std::vector<int> values = randomValues(rng() % 10, 100);
+            ModernVersion::LinkedList other(values.begin(), values.end());
+            if (rng() & 1) {
+                list.splice(other);
+                reference.insert(reference.end(), values.begin(), values.end());
+            } else {
+                list.splice_front(other);
+                reference.insert(reference.begin(), values.begin(), values.end());
+            }
+            assert(!other.getHead());
+            break;
+        }
+        case 6: list.reverse(); reference.reverse(); break;
+        case 7: {
+            const int divisor = static_cast<int>(rng() % 5) + 2;
+            auto pred = [divisor](int v) { return v % divisor == 0; };
+            const size_t before = reference.size();
+            reference.remove_if(pred);
+            assert(list.remove_if(pred) == before - reference.size());
+            break;
+        }
+        case 8: {
+            const size_t before = reference.size();
+            reference.unique();
+            assert(list.unique() == before - reference.size());
+            break;
+        }
+        case 9:
+            if (reference.size() > 200) {
+                list.clear();
+                reference.clear();
+            }
+            break;
+        default: {
+            // 尾节点必须始终正确：push_back 后末尾就是新值
+            list.push_back(value);
+            reference.push_back(value);
+            break;
+        }
+        }
+        assert(sameElements(list, reference));
+    }
+    std::cout << "✓ 2 万次随机操作（sort/merge/splice/reverse/remove_if/unique）与 std::list 一致" << std::endl;
+    
+    // 大规模排序与 std::stable_sort 对照（不递归，长链表也不会耗尽栈）
+    std::vector<int> values = randomValues(200000, 1000);
+    ModernVersion::LinkedList big(values.begin(), values.end());
+    big.sort();
+    std::stable_sort(values.begin(), values.end());
+    assert(toVector(big) == values);
+    std::cout << "✓ 20 万个元素的 sort 与 std::stable_sort 一致" << std::endl;
+    
+    // merge 的输入无序时，结果顺序不作保证，但尾节点仍必须正确，之后的 push_back 不能丢失节点
+    for (int round = 0; round < 100; ++round) {
+        std::vector<int> left = randomValues(rng() % 8, 50);
+        std::vector<int> right = randomValues(rng() % 8 + 1, 50);
+        ModernVersion::LinkedList a(left.begin(), left.end());
+        ModernVersion::LinkedList b(right.begin(), right.end());
+        a.merge(b);
+        a.push_back(-1);
+        std::vector<int> merged = toVector(a);
+        assert(merged.size() == left.size() + right.size() + 1 && merged.back() == -1);
+        std::vector<int> expected = left;
+        expected.insert(expected.end(), right.begin(), right.end());
+        expected.push_back(-1);
+        std::sort(expected.begin(), expected.end());
+        std::sort(merged.begin(), merged.end());
+        assert(merged == expected);
+    }
+    std::cout << "✓ 无序输入的 merge 后 push_back 不丢失节点" << std::endl;
+}
+
+template <typename List>
+std::vector<int> jobIds(const List& list) {
+    std::vector<int> ids;
+    for (const Job& job : list) {
+        ids.push_back(job.id);
+    }
+    return ids;
+}
+
+void testIntrusiveList() {
+    std::cout << "=== 测试侵入式链表（钩子、splice、移动） ===" << std::endl;
+    
+    using ReadyList = IntrusiveVersion::LinkedList<Job, ReadyTag>;
+    using AllList = IntrusiveVersion::LinkedList<Job, AllTag>;
+    using ReadyHook = IntrusiveVersion::ListHook<ReadyTag>;
+    using AllHook = IntrusiveVersion::ListHook<AllTag>;
+    
+    std::vector<Job> jobs;
+    for (int i = 0; i < 8; ++i) {
+        jobs.emplace_back(i);  // 链接之前放满：vector 扩容时拷贝出的钩子是未链接的
+    }
+    
+    // 同一个对象通过两个 Tag 挂在两条链表上，互不影响
+    {
+        ReadyList ready;
+        AllList all;
+        for (Job& job : jobs) {
+            all.push_back(job);
+            if (job.id % 2 == 0) {
+                ready.push_front(job);
+            }
+        }
+        assert(jobIds(all) == (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+        assert(jobIds(ready) == (std::vector<int>{6, 4, 2, 0}));
+        ReadyList::remove(jobs[4]);
+        assert(!static_cast<ReadyHook&>(jobs[4]).isLinked());
+        assert(static_cast<AllHook&>(jobs[4]).isLinked());
+        assert(jobIds(ready) == (std::vector<int>{6, 2, 0}) && all.size() == 8);
+        assert(&*AllList::iterator_to(jobs[5]) == &jobs[5]);
+        all.erase(AllList::iterator_to(jobs[5]));
+        assert(jobIds(all) == (std::vector<int>{0, 1, 2, 3, 4, 6, 7}));
+        
+#ifndef NDEBUG
+        // 调试构建下重复链接同一个钩子抛出 logic_error，链表保持不变
+        bool threw = false;
+        try {
+            ready.push_back(jobs[2]);
+        } catch (const std::logic_error&) {
+            threw = true;
+        }
+        assert(threw && jobIds(ready) == (std::vector<int>{6, 2, 0}));
+        threw = false;
+        try {
+            all.insert(all.begin(), jobs[0]);
+        } catch (const std::logic_error&) {
+            threw = true;
+        }
+        assert(threw && all.size() == 7);
+#endif
+        
+        // clear() 只摘下元素：钩子回到未链接状态，另一条链表不受影响
+        ready.clear();
+        assert(ready.empty());
+        for (Job& job : jobs) {
+            assert(!static_cast<ReadyHook&>(job).isLinked());
+        }
+        assert(all.size() == 7);
+        ready.push_back(jobs[2]);  // 摘下后可以再次链接
+        assert(ready.front().id == 2);
+    }
+    // 链表析构同样摘下所有元素
+    for (Job& job : jobs) {
+        assert(!static_cast<ReadyHook&>(job).isLinked());
+        assert(!static_cast<AllHook&>(job).isLinked());
+    }
+    std::cout << "✓ 两个 Tag、重复链接检查、clear 与析构" << std::endl;
+    
+    // 元素先于链表销毁时自动摘下
+    {
+        AllList all;
+        all.push_back(jobs[0]);
+        {
+            Job temporary(100);
+            all.push_back(temporary);
+            all.push_back(jobs[1]);
+            ReadyList ready;
+            ready.push_back(temporary);
+            assert(all.size() == 3 && all.back().id == 1);
+        }
+        assert(jobIds(all) == (std::vector<int>{0, 1}));
+        auto doomed = std::make_unique<Job>(200);
+        all.push_front(*doomed);
+        doomed.reset();
+        assert(jobIds(all) == (std::vector<int>{0, 1}));
+    }
+    std::cout << "✓ 元素析构时自动摘下" << std::endl;
+    
+    // splice：单个、区间、整条
+    {
+        ReadyList source;
+        ReadyList target;
+        for (int i = 0; i < 6; ++i) {
+            source.push_back(jobs[static_cast<size_t>(i)]);
+        }
+        target.push_back(jobs[6]);
+        target.push_back(jobs[7]);
+        
+        target.splice(target.begin(), source, ReadyList::iterator_to(jobs[3]));
+        assert(jobIds(target) == (std::vector<int>{3, 6, 7}));
+        assert(jobIds(source) == (std::vector<int>{0, 1, 2, 4, 5}));
+        
+        // [1, 4) 接到 7 之前
+        target.splice(ReadyList::iterator_to(jobs[7]), source, ReadyList::iterator_to(jobs[1]),
+                      ReadyList::iterator_to(jobs[4]));
+        assert(jobIds(target) == (std::vector<int>{3, 6, 1, 2, 7}));
+        assert(jobIds(source) == (std::vector<int>{0, 4, 5}));
+        
+        // 同一条链表内移动，以及空区间
+        target.splice(target.end(), target, target.begin());
+        assert(jobIds(target) == (std::vector<int>{6, 1, 2, 7, 3}));
+        target.splice(target.begin(), source, source.begin(), source.begin());
+        assert(source.size() == 3 && target.size() == 5);
+        
+        target.splice(target.begin(), source);
+        assert(source.empty());
+        assert(jobIds(target) == (std::vector<int>{0, 4, 5, 6, 1, 2, 7, 3}));
+        target.splice(target.end(), source);  // 空链表
+        assert(target.size() == 8 && target.back().id == 3);
+        
+        // 反向遍历同样完整
+        std::vector<int> backwards;
+        for (auto it = target.end(); it != target.begin();) {
+            --it;
+            backwards.push_back(it->id);
+        }
+        assert(backwards == (std::vector<int>{3, 7, 2, 1, 6, 5, 4, 0}));
+    }
+    std::cout << "✓ 单个、区间、整条 splice" << std::endl;
+    
+    // 移动构造与移动赋值：元素不动，只转移链接
+    {
+        ReadyList first;
+        first.push_back(jobs[0]);
+        first.push_back(jobs[1]);
+        ReadyList moved(std::move(first));
+        assert(first.empty() && jobIds(moved) == (std::vector<int>{0, 1}));
+        first.push_back(jobs[2]);  // 移走后仍可使用
+        
+        ReadyList assigned;
+        assigned.push_back(jobs[3]);
+        assigned = std::move(moved);
+        assert(moved.empty() && jobIds(assigned) == (std::vector<int>{0, 1}));
+        assert(!static_cast<ReadyHook&>(jobs[3]).isLinked());  // 原有元素被摘下
+        
+        ReadyList empty;
+        assigned = std::move(empty);
+        assert(assigned.empty() && !static_cast<ReadyHook&>(jobs[0]).isLinked());
+        assert(jobIds(first) == (std::vector<int>{2}));
+    }
+    
+    ReadyList empty;
+    bool threw = false;
+    try {
+        empty.pop_back();
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "✓ 移动构造、移动赋值与空链表异常" << std::endl;
+}
+
+// 随机的两端操作和中间插入、删除，反复触发节点拆分、合并和借入
+template <typename T, typename MakeValue>
+void fuzzUnrolledList(MakeValue makeValue) {
+    std::mt19937 rng(11);
+    UnrolledVersion::LinkedList<T> list;
+    std::list<T> reference;
+    for (int step = 0; step < 50000; ++step) {
+        const T value = makeValue(step);
+        const size_t position = reference.empty() ? 0 : rng() % (reference.size() + 1);
+        switch (rng() % 10) {
+        case 0: list.push_front(value); reference.push_front(value); break;
+        case 1: list.push_back(value); reference.push_back(value); break;
+        case 8:
+            // 参数引用链表自身的元素：整理节点时不能先移走它
+            if (!reference.empty()) {
+                list.push_back(list.front());
+                reference.push_back(reference.front());
+            }
+            break;
+        case 9:
+            if (!reference.empty()) {
+                list.push_front(list.back());
+                reference.push_front(reference.back());
+            }
+            break;
+        case 2:
+            if (!reference.empty()) {
+                assert(list.front() == reference.front());
+                list.pop_front();
+                reference.pop_front();
+            }
+            break;
+        case 3:
+            if (!reference.empty()) {
+                assert(list.back() == reference.back());
+                list.pop_back();
+                reference.pop_back();
+            }
+            break;
+        case 4:
+        case 5: {
+            auto it = list.insert(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(position)), value);
+            reference.insert(std::next(reference.begin(), static_cast<std::ptrdiff_t>(position)), value);
+            assert(*it == value);
+            break;
+        }
+        default:
+            if (position < reference.size()) {
+                auto it = list.erase(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(position)));
+                auto expected = reference.erase(std::next(reference.begin(), static_cast<std::ptrdiff_t>(position)));
+                assert((it == list.end()) == (expected == reference.end()));
+                assert(it == list.end() || *it == *expected);
+            }
+            break;
+        }
+        assert(list.size() == reference.size());
+        assert(list.nodeCount() <= list.size());
+        if (step % 64 == 0) {
+            assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+        }
+    }
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    
+    UnrolledVersion::LinkedList<T> copy(list);
+    UnrolledVersion::LinkedList<T> moved(std::move(list));
+    assert(std::equal(copy.begin(), copy.end(), reference.begin(), reference.end()));
+    assert(std::equal(moved.begin(), moved.end(), reference.begin(), reference.end()));
+    assert(list.empty());
+}
+
+void testUnrolledList() {
+    std::cout << "=== 测试展开链表（对照 std::list） ===" << std::endl;
+    
+    fuzzUnrolledList<int>([](int step) { return step; });
+    fuzzUnrolledList<std::string>([](int step) { return "value-" + std::to_string(step); });
+    std::cout << "✓ int / std::string 各 5 万次随机操作（含拆分、合并、借入）与 std::list 一致" << std::endl;
+    
+    // 端节点只有另一侧有空位时，push_back(back()) / push_front(front()) 会先整理节点
+    UnrolledVersion::LinkedList<std::string> aliased;
+    aliased.push_front("second");
+    aliased.push_front("first");  // 头节点从后往前填：尾部没有空位
+    aliased.push_back(aliased.back());
+    assert(aliased.back() == "second");
+    UnrolledVersion::LinkedList<std::string> reversed;
+    reversed.push_back("first");
+    reversed.push_back("second");  // 尾节点从前往后填：头部没有空位
+    reversed.push_front(reversed.front());
+    assert(reversed.front() == "first");
+    assert(aliased.size() == 3 && reversed.size() == 3);
+    std::cout << "✓ 参数引用链表自身元素时整理节点不破坏参数" << std::endl;
+    
+    UnrolledVersion::LinkedList<int> empty;
+    bool thrown = false;
+    try {
+        empty.pop_front();
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "✓ 空链表 pop_front 抛出 std::out_of_range" << std::endl;
+}
+
+void testLockFreeStack() {
+    std::cout << "=== 测试无锁栈（并发 push / pop / pop_all） ===" << std::endl;
+    
+    // 每个值只压入一次：弹出的元素既不能丢失也不能重复
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 20000;
+    constexpr int TOTAL = THREADS * PER_THREAD;
+    ConcurrentVersion::LockFreeStack<int> stack;
+    std::vector<std::atomic<int>> seen(static_cast<size_t>(TOTAL));
+    std::atomic<long long> popped{0};
+    std::atomic<long long> checksum{0};
+    auto take = [&](int value) {
+        assert(value >= 0 && value < TOTAL);
+        // 副作用不放进 assert：定义 NDEBUG 时也要计数
+        const int previous = seen[static_cast<size_t>(value)].fetch_add(1, std::memory_order_relaxed);
+        assert(previous == 0);
+        (void)previous;
+        popped.fetch_add(1, std::memory_order_relaxed);
+        checksum.fetch_add(value, std::memory_order_relaxed);
+    };
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&stack, &take, t]() {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                stack.push(t * PER_THREAD + i);
+                if (i % 3 == 0) {
+                    if (auto value = stack.pop()) {
+                        take(*value);
+                    }
+                }
+                if (t == 0 && i % 1000 == 999) {
+                    stack.pop_all([&take](int&& value) { take(value); });  // 与其他线程的 pop 竞争
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stack.pop_all([&take](int&& value) { take(value); });
+    
+    assert(stack.isEmpty());
+    assert(!stack.pop());
+    assert(popped.load() == TOTAL);
+    assert(checksum.load() == static_cast<long long>(TOTAL) * (TOTAL - 1) / 2);
+    std::cout << "✓ " << THREADS << " 个线程共压入 " << TOTAL << " 个元素，每个恰好弹出一次" << std::endl;
+}
+
+void testSkipList() {
+    std::cout << "=== 测试跳表（对照 std::set） ===" << std::endl;
+    
+    std::mt19937 rng(1);
+    OrderedVersion::SkipList<int> list;
+    std::set<int> reference;
+    for (int step = 0; step < 200000; ++step) {
+        const int key = static_cast<int>(rng() % 5000);
+        switch (rng() % 4) {
+        case 0:
+        case 1:
+            assert(list.insert(key) == reference.insert(key).second);
+            break;
+        case 2:
+            assert(list.erase(key) == (reference.erase(key) == 1));
+            break;
+        default: {
+            auto lower = list.lower_bound(key);
+            auto expectedLower = reference.lower_bound(key);
+            assert((lower == list.end()) == (expectedLower == reference.end()));
+            assert(lower == list.end() || *lower == *expectedLower);
+            auto upper = list.upper_bound(key);
+            auto expectedUpper = reference.upper_bound(key);
+            assert((upper == list.end()) == (expectedUpper == reference.end()));
+            assert(upper == list.end() || *upper == *expectedUpper);
+            assert(list.contains(key) == (reference.count(key) == 1));
+            
+            std::vector<int> range;
+            list.for_each_in_range(key, key + 100, [&range](int value) { range.push_back(value); });
+            assert(std::equal(range.begin(), range.end(),
+                              reference.lower_bound(key), reference.lower_bound(key + 100)));
+            break;
+        }
+        }
+        assert(list.size() == reference.size());
+    }
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    std::cout << "✓ 20 万次随机操作与 std::set 一致" << std::endl;
+    
+    OrderedVersion::SkipList<int> moved(std::move(list));
+    assert(list.empty() && list.begin() == list.end());
+    assert(list.insert(1) && list.size() == 1);  // 被移走的跳表仍可使用
+    list = std::move(moved);
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    std::cout << "✓ 移动构造与移动赋值" << std::endl;
+}
+
+void testConcurrentSkipList() {
+    std::cout << "=== 测试并发跳表（读者与写者同时运行） ===" << std::endl;
+    
+    // 写者只插入、删除 3 的倍数，读者查询任意键：结果不能越出所查的范围，也不能出现写者从未插入的键
+    ConcurrentVersion::ConcurrentSkipList<int> list;
+    constexpr int KEY_RANGE = 30000;
+    for (int key = 0; key < KEY_RANGE; key += 6) {
+        list.insert(key);  // 6 的倍数常驻
+    }
+    
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < 3; ++t) {
+        readers.emplace_back([&list, &stop, t]() {
+            std::mt19937 rng(t + 1);
+            while (!stop.load(std::memory_order_relaxed)) {
+                const int key = static_cast<int>(rng() % KEY_RANGE);
+                const bool found = list.contains(key);
+                assert(!found || key % 3 == 0);
+                assert(key % 6 != 0 || found);
+                
+                auto lower = list.lower_bound(key);
+                assert(lower || key > KEY_RANGE - 6);  // 之后还有常驻键时一定能找到
+                assert(!lower || (*lower >= key && *lower % 3 == 0));
+                
+                int previous = key - 1;
+                list.for_each_in_range(key, key + 20, [&previous, key](int value) {
+                    assert(value >= key && value < key + 20 && value > previous && value % 3 == 0);
+                    previous = value;
+                });
+            }
+        });
+    }
+    
+    std::mt19937 rng(42);
+    for (int step = 0; step < 200000; ++step) {
+        const int key = static_cast<int>(rng() % (KEY_RANGE / 6)) * 6 + 3;  // 3 的奇数倍
+        if (rng() & 1) {
+            list.insert(key);
+        } else {
+            list.erase(key);
+        }
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    size_t permanent = list.for_each_in_range(0, KEY_RANGE, [](int value) { assert(value % 3 == 0); });
+    assert(permanent == list.size());
+    std::cout << "✓ 3 个读者与 1 个写者并发，读到的键始终在查询范围内" << std::endl;
+}
+
 int main() {
+    // 演示程序打开节点生命周期日志（默认关闭）
+    setLifecycleLog(&std::cout);
+    
     std::cout << "==================================================" << std::endl;
     std::cout << "  std::unique_ptr 演示：独占所有权的智能指针" << std::endl;
     std::cout << "==================================================" << std::endl;
@@ -71,6 +945,36 @@ int main() {
     // 演示移动语义
     demonstrateMoveSemantics();
     
+    // 演示节点池
+    demonstrateNodePool();
+    
+    // 演示原地算法
+    demonstrateListAlgorithms();
+    
+    // 演示展开链表
+    demonstrateUnrolledList();
+    
+    // 演示无锁栈
+    demonstrateLockFreeStack();
+    
+    // 演示侵入式链表
+    demonstrateIntrusiveList();
+    
+    // 演示跳表
+    demonstrateSkipList();
+    
+    // 自测
+    setLifecycleLog(nullptr);
+    std::cout << "\n========== 自测 ==========\n" << std::endl;
+    testNodePool();
+    testListAlgorithms();
+    testIntrusiveList();
+    testUnrolledList();
+    testLockFreeStack();
+    testSkipList();
+    testConcurrentSkipList();
+    std::cout << "\n所有自测通过 ✓" << std::endl;
+    
     std::cout << "\n==================================================" << std::endl;
     std::cout << "关键知识点总结：" << std::endl;
     std::cout << "1. 零开销抽象：unique_ptr 没有运行时开销" << std::endl;
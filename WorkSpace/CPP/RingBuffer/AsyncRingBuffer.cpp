@@ -0,0 +1,160 @@
+#ifndef ASYNCRINGBUFFER_CPP
+#define ASYNCRINGBUFFER_CPP
+
+#include "AsyncRingBuffer.hpp"
+#include <exception>
+
+// ---------------------------------------------------------------------------
+// CoroutineExecutor / AsyncTask（非模板，随头文件包含，因此声明为 inline）
+// ---------------------------------------------------------------------------
+inline CoroutineExecutor::CoroutineExecutor(size_t initialCapacity)
+    : ready(initialCapacity, true) {
+    ready.setOverflowPolicy(OverflowPolicy::Grow);
+}
+
+inline void CoroutineExecutor::schedule(std::coroutine_handle<> handle) {
+    ready.push(handle);
+}
+
+inline size_t CoroutineExecutor::run() {
+    size_t resumed = 0;
+    while (auto handle = ready.pop()) {
+        handle->resume();
+        ++resumed;
+    }
+    return resumed;
+}
+
+inline size_t CoroutineExecutor::pendingCount() const noexcept {
+    return ready.size();
+}
+
+inline AsyncTask AsyncTask::promise_type::get_return_object() noexcept {
+    return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+// 没有人等待 fire-and-forget 协程的结果，异常无处传递
+inline void AsyncTask::promise_type::unhandled_exception() const noexcept {
+    std::terminate();
+}
+
+inline AsyncTask::AsyncTask(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+
+inline AsyncTask::AsyncTask(AsyncTask&& other) noexcept
+    : handle(std::exchange(other.handle, nullptr)) {}
+
+inline AsyncTask::~AsyncTask() {
+    if (handle) {
+        handle.destroy();
+    }
+}
+
+inline void AsyncTask::start(CoroutineExecutor& executor) && {
+    executor.schedule(std::exchange(handle, nullptr));
+}
+
+// ---------------------------------------------------------------------------
+// AsyncRingBuffer
+// ---------------------------------------------------------------------------
+template <typename T>
+AsyncRingBuffer<T>::AsyncRingBuffer(size_t size, CoroutineExecutor& exec)
+    : ring(size), executor(exec) {}
+
+template <typename T>
+bool AsyncRingBuffer<T>::offer(T& item) {
+    if (PopAwaiter* waiter = popWaiters.pop()) {
+        // 有消费者在等，缓冲区必然为空：直接交接，不经过缓冲区
+        waiter->result.emplace(std::move(item));
+        executor.schedule(waiter->handle);
+        return true;
+    }
+    return ring.push(std::move(item));  // 失败时不会移走 item
+}
+
+template <typename T>
+bool AsyncRingBuffer<T>::try_push(T item) {
+    return offer(item);
+}
+
+template <typename T>
+std::optional<T> AsyncRingBuffer<T>::try_pop() {
+    std::optional<T> item = ring.pop();
+    if (item) {
+        // 腾出了一个空位：让最早挂起的生产者把它的元素放进来
+        if (PushAwaiter* waiter = pushWaiters.pop()) {
+            ring.push(std::move(waiter->value));
+            executor.schedule(waiter->handle);
+        }
+    }
+    return item;
+}
+
+template <typename T>
+typename AsyncRingBuffer<T>::PopAwaiter AsyncRingBuffer<T>::async_pop() noexcept {
+    return PopAwaiter(*this);
+}
+
+template <typename T>
+typename AsyncRingBuffer<T>::PushAwaiter AsyncRingBuffer<T>::async_push(T item) {
+    return PushAwaiter(*this, std::move(item));
+}
+
+template <typename T>
+bool AsyncRingBuffer<T>::PopAwaiter::await_ready() {
+    result = owner.try_pop();
+    return result.has_value();
+}
+
+template <typename T>
+void AsyncRingBuffer<T>::PopAwaiter::await_suspend(std::coroutine_handle<> h) noexcept {
+    handle = h;
+    owner.popWaiters.push(this);
+}
+
+template <typename T>
+T AsyncRingBuffer<T>::PopAwaiter::await_resume() {
+    return std::move(*result);
+}
+
+template <typename T>
+bool AsyncRingBuffer<T>::PushAwaiter::await_ready() {
+    return owner.offer(value);
+}
+
+template <typename T>
+void AsyncRingBuffer<T>::PushAwaiter::await_suspend(std::coroutine_handle<> h) noexcept {
+    handle = h;
+    owner.pushWaiters.push(this);
+}
+
+template <typename T>
+bool AsyncRingBuffer<T>::isEmpty() const noexcept {
+    return ring.isEmpty();
+}
+
+template <typename T>
+bool AsyncRingBuffer<T>::isFull() const noexcept {
+    return ring.isFull();
+}
+
+template <typename T>
+size_t AsyncRingBuffer<T>::size() const noexcept {
+    return ring.size();
+}
+
+template <typename T>
+size_t AsyncRingBuffer<T>::getCapacity() const noexcept {
+    return ring.getCapacity();
+}
+
+template <typename T>
+size_t AsyncRingBuffer<T>::waitingPoppers() const noexcept {
+    return popWaiters.count;
+}
+
+template <typename T>
+size_t AsyncRingBuffer<T>::waitingPushers() const noexcept {
+    return pushWaiters.count;
+}
+
+#endif // ASYNCRINGBUFFER_CPP
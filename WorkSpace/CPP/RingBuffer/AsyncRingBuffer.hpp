@@ -0,0 +1,157 @@
+#ifndef ASYNCRINGBUFFER_HPP
+#define ASYNCRINGBUFFER_HPP
+
+#include "RingBuffer.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// C++20 协程接口：co_await ring.async_pop() / co_await ring.async_push(x)
+// 缓冲区为空（满）时挂起当前协程；改变状态的一方（push / pop）负责唤醒等待者，
+// 把它交给执行器排队恢复。等待节点直接嵌在 awaiter 里（位于协程帧中），
+// 通过侵入式链表串起来，因此每次等待都不需要额外的堆分配。
+// 所有对象只能在执行器所在的单个线程中使用。
+
+// 最小的单线程执行器：就绪队列本身就是一个自动扩容的 RingBuffer
+class CoroutineExecutor {
+private:
+    RingBuffer<std::coroutine_handle<>> ready;
+
+public:
+    explicit CoroutineExecutor(size_t initialCapacity = 1024);
+
+    CoroutineExecutor(const CoroutineExecutor&) = delete;
+    CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+
+    // 把协程放入就绪队列（不会立即恢复，避免恢复链过深）
+    void schedule(std::coroutine_handle<> handle);
+    // 依次恢复就绪的协程，直到队列为空；返回恢复的次数
+    size_t run();
+    size_t pendingCount() const noexcept;
+};
+
+// 由执行器启动、运行结束后自行销毁的协程（fire-and-forget）
+class AsyncTask {
+public:
+    struct promise_type {
+        AsyncTask get_return_object() noexcept;
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept;
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit AsyncTask(std::coroutine_handle<promise_type> h) noexcept;
+
+public:
+    AsyncTask(AsyncTask&& other) noexcept;
+    AsyncTask& operator=(AsyncTask&&) = delete;
+    ~AsyncTask();  // 从未被启动的协程在这里销毁
+
+    // 交给执行器：之后协程帧的生命周期由协程自己管理
+    void start(CoroutineExecutor& executor) &&;
+};
+
+template <typename T>
+class AsyncRingBuffer {
+public:
+    class PopAwaiter;
+    class PushAwaiter;
+
+private:
+    // 先进先出的侵入式等待队列：节点就是挂起中的 awaiter 本身
+    template <typename Awaiter>
+    struct WaitQueue {
+        Awaiter* head = nullptr;
+        Awaiter* tail = nullptr;
+        size_t count = 0;
+
+        void push(Awaiter* waiter) noexcept {
+            waiter->next = nullptr;
+            (tail ? tail->next : head) = waiter;
+            tail = waiter;
+            ++count;
+        }
+        Awaiter* pop() noexcept {
+            Awaiter* waiter = head;
+            if (waiter) {
+                head = waiter->next;
+                if (!head) {
+                    tail = nullptr;
+                }
+                --count;
+            }
+            return waiter;
+        }
+    };
+
+    RingBuffer<T> ring;
+    CoroutineExecutor& executor;
+    WaitQueue<PopAwaiter> popWaiters;    // 空时挂起的消费者（此时缓冲区一定为空）
+    WaitQueue<PushAwaiter> pushWaiters;  // 满时挂起的生产者（此时缓冲区一定是满的）
+
+    // 写入或直接交给等待中的消费者；只有成功时才会移走 item
+    bool offer(T& item);
+
+public:
+    class PopAwaiter {
+    private:
+        AsyncRingBuffer& owner;
+        std::coroutine_handle<> handle;
+        PopAwaiter* next = nullptr;
+        std::optional<T> result;  // 生产者直接把元素交到这里
+        friend class AsyncRingBuffer;
+
+    public:
+        explicit PopAwaiter(AsyncRingBuffer& rb) noexcept : owner(rb) {}
+
+        bool await_ready();
+        void await_suspend(std::coroutine_handle<> h) noexcept;
+        T await_resume();
+    };
+
+    class PushAwaiter {
+    private:
+        AsyncRingBuffer& owner;
+        std::coroutine_handle<> handle;
+        PushAwaiter* next = nullptr;
+        T value;  // 挂起期间由 awaiter 保管，消费者腾出空间后放入缓冲区
+        friend class AsyncRingBuffer;
+
+    public:
+        PushAwaiter(AsyncRingBuffer& rb, T item) : owner(rb), value(std::move(item)) {}
+
+        bool await_ready();
+        void await_suspend(std::coroutine_handle<> h) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    AsyncRingBuffer(size_t size, CoroutineExecutor& exec);
+
+    AsyncRingBuffer(const AsyncRingBuffer&) = delete;
+    AsyncRingBuffer& operator=(const AsyncRingBuffer&) = delete;
+
+    // 等待到有元素可读 / 有空位可写
+    [[nodiscard]] PopAwaiter async_pop() noexcept;
+    [[nodiscard]] PushAwaiter async_push(T item);
+
+    // 非阻塞操作，同样会唤醒对方的等待者
+    bool try_push(T item);
+    std::optional<T> try_pop();
+
+    // 状态查询
+    bool isEmpty() const noexcept;
+    bool isFull() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+    size_t waitingPoppers() const noexcept;
+    size_t waitingPushers() const noexcept;
+};
+
+#include "AsyncRingBuffer.cpp"
+
+#endif // ASYNCRINGBUFFER_HPP
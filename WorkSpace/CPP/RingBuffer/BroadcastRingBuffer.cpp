@@ -0,0 +1,185 @@
+#ifndef BROADCASTRINGBUFFER_CPP
+#define BROADCASTRINGBUFFER_CPP
+
+#include "BroadcastRingBuffer.hpp"
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+template <typename T>
+BroadcastRingBuffer<T>::BroadcastRingBuffer(size_t size)
+    : capacity(std::bit_ceil(size)), mask(capacity - 1), tail(0), cachedGate(0) {
+    if (size == 0) {
+        throw std::invalid_argument("BroadcastRingBuffer size must be greater than 0");
+    }
+    buffer = std::make_unique<T[]>(capacity);
+}
+
+template <typename T>
+size_t BroadcastRingBuffer<T>::addConsumer(const std::vector<size_t>& dependsOn) {
+    auto cursor = std::make_unique<Cursor>();
+    const uint64_t start = tail.load(std::memory_order_acquire);
+    cursor->position.store(start, std::memory_order_relaxed);
+    cursor->cachedLimit = start;
+    for (size_t id : dependsOn) {
+        Cursor& dependency = cursorAt(id);
+        dependency.gating = false;  // 被依赖的消费者总是走在前面，生产者只需看末端
+        cursor->dependencies.push_back(&dependency);
+    }
+    cursors.push_back(std::move(cursor));
+
+    gatingCursors.clear();
+    for (const auto& c : cursors) {
+        if (c->gating) {
+            gatingCursors.push_back(c.get());
+        }
+    }
+    cachedGate = slowestGate();
+    return cursors.size() - 1;
+}
+
+template <typename T>
+size_t BroadcastRingBuffer<T>::getConsumerCount() const noexcept {
+    return cursors.size();
+}
+
+template <typename T>
+typename BroadcastRingBuffer<T>::Cursor& BroadcastRingBuffer<T>::cursorAt(size_t consumer) const {
+    if (consumer >= cursors.size()) {
+        throw std::out_of_range("BroadcastRingBuffer consumer id out of range");
+    }
+    return *cursors[consumer];
+}
+
+template <typename T>
+uint64_t BroadcastRingBuffer<T>::slowestGate() const noexcept {
+    uint64_t slowest = tail.load(std::memory_order_relaxed);
+    for (const Cursor* cursor : gatingCursors) {
+        slowest = std::min(slowest, cursor->position.load(std::memory_order_acquire));
+    }
+    return slowest;
+}
+
+template <typename T>
+uint64_t BroadcastRingBuffer<T>::limitOf(Cursor& cursor) const noexcept {
+    if (cursor.dependencies.empty()) {
+        return tail.load(std::memory_order_acquire);
+    }
+    // 依赖方的游标以 release 发布，acquire 读取后它们看到的写入对本消费者同样可见
+    uint64_t limit = UINT64_MAX;
+    for (const Cursor* dependency : cursor.dependencies) {
+        limit = std::min(limit, dependency->position.load(std::memory_order_acquire));
+    }
+    return limit;
+}
+
+// ---------------------------------------------------------------------------
+// 生产者操作：只写 tail，读游标时优先使用本地缓存
+// ---------------------------------------------------------------------------
+template <typename T>
+bool BroadcastRingBuffer<T>::push(const T& item) {
+    const uint64_t t = tail.load(std::memory_order_relaxed);
+    if (t - cachedGate >= capacity) {
+        cachedGate = slowestGate();
+        if (t - cachedGate >= capacity) {
+            return false;
+        }
+    }
+
+    buffer[t & mask] = item;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool BroadcastRingBuffer<T>::push(T&& item) {
+    const uint64_t t = tail.load(std::memory_order_relaxed);
+    if (t - cachedGate >= capacity) {
+        cachedGate = slowestGate();
+        if (t - cachedGate >= capacity) {
+            return false;
+        }
+    }
+
+    buffer[t & mask] = std::move(item);
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+size_t BroadcastRingBuffer<T>::pushMultiple(const T* items, size_t num) {
+    const uint64_t t = tail.load(std::memory_order_relaxed);
+    size_t space = capacity - static_cast<size_t>(t - cachedGate);
+    if (space < num) {
+        cachedGate = slowestGate();
+        space = capacity - static_cast<size_t>(t - cachedGate);
+    }
+
+    const size_t n = std::min(num, space);
+    const size_t start = static_cast<size_t>(t) & mask;
+    const size_t first = std::min(n, capacity - start);
+    std::copy(items, items + first, buffer.get() + start);
+    std::copy(items + first, items + n, buffer.get());
+
+    // 整批只发布一次 tail
+    tail.store(t + n, std::memory_order_release);
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// 消费者操作：只写自己的游标
+// ---------------------------------------------------------------------------
+template <typename T>
+template <typename F>
+size_t BroadcastRingBuffer<T>::consume(size_t consumer, F&& f) {
+    return consume_up_to(consumer, SIZE_MAX, std::forward<F>(f));
+}
+
+template <typename T>
+template <typename F>
+size_t BroadcastRingBuffer<T>::consume_up_to(size_t consumer, size_t num, F&& f) {
+    Cursor& cursor = cursorAt(consumer);
+    const uint64_t pos = cursor.position.load(std::memory_order_relaxed);
+    if (cursor.cachedLimit - pos < num) {
+        cursor.cachedLimit = limitOf(cursor);
+    }
+
+    const size_t n = static_cast<size_t>(std::min<uint64_t>(num, cursor.cachedLimit - pos));
+    const size_t start = static_cast<size_t>(pos) & mask;
+    const size_t first = std::min(n, capacity - start);
+    const T* data = buffer.get();
+    for (size_t i = 0; i < first; ++i) {
+        f(data[start + i]);
+    }
+    for (size_t i = 0; i < n - first; ++i) {
+        f(data[i]);
+    }
+
+    if (n > 0) {
+        cursor.position.store(pos + n, std::memory_order_release);
+    }
+    return n;
+}
+
+template <typename T>
+bool BroadcastRingBuffer<T>::pop(size_t consumer, T& item) {
+    return consume_up_to(consumer, 1, [&item](const T& value) { item = value; }) == 1;
+}
+
+template <typename T>
+size_t BroadcastRingBuffer<T>::available(size_t consumer) const {
+    Cursor& cursor = cursorAt(consumer);
+    return static_cast<size_t>(limitOf(cursor) - cursor.position.load(std::memory_order_relaxed));
+}
+
+template <typename T>
+size_t BroadcastRingBuffer<T>::getCapacity() const noexcept {
+    return capacity;
+}
+
+template <typename T>
+uint64_t BroadcastRingBuffer<T>::getPublishedCount() const noexcept {
+    return tail.load(std::memory_order_acquire);
+}
+
+#endif // BROADCASTRINGBUFFER_CPP
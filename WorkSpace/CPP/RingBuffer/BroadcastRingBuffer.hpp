@@ -0,0 +1,78 @@
+#ifndef BROADCASTRINGBUFFER_HPP
+#define BROADCASTRINGBUFFER_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 单生产者广播环形缓冲区（Disruptor 风格）
+// 生产者只写一次，每个消费者持有自己的读游标，原地读取同一份元素，
+// 因此无论注册多少个消费者，写入次数和拷贝次数都不变。
+// 消费者之间可以声明依赖：某个消费者只能读到它所依赖的消费者都已处理完的元素
+// （例如 处理 → 落盘 → 确认）；生产者只需等待最慢的末端消费者。
+template <typename T>
+class BroadcastRingBuffer {
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // 每个消费者独占一条缓存行
+    struct alignas(CACHE_LINE_SIZE) Cursor {
+        std::atomic<uint64_t> position{0};      // 已处理的元素个数（下一个要读的写计数）
+        uint64_t cachedLimit = 0;                // 消费者本地缓存的可读上限
+        std::vector<const Cursor*> dependencies; // 为空时直接以生产者的 tail 为上限
+        bool gating = true;                      // 没有其他消费者依赖它时，生产者需要等待它
+    };
+
+    std::unique_ptr<T[]> buffer;
+    size_t capacity;
+    size_t mask;
+    std::vector<std::unique_ptr<Cursor>> cursors;  // 指针在注册后保持稳定
+
+    // 生产者独占的缓存行：tail 以及对最慢游标的本地缓存
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;
+    uint64_t cachedGate;
+    std::vector<const Cursor*> gatingCursors;
+
+    uint64_t slowestGate() const noexcept;     // 末端消费者中最小的游标
+    uint64_t limitOf(Cursor& cursor) const noexcept;  // 消费者当前可读到的写计数
+    Cursor& cursorAt(size_t consumer) const;
+
+public:
+    // 构造函数（容量向上取整为 2 的幂）
+    explicit BroadcastRingBuffer(size_t size);
+
+    ~BroadcastRingBuffer() = default;
+
+    BroadcastRingBuffer(const BroadcastRingBuffer&) = delete;
+    BroadcastRingBuffer& operator=(const BroadcastRingBuffer&) = delete;
+
+    // 注册消费者，返回其编号；dependsOn 中的消费者都处理完的元素才对它可见。
+    // 必须在生产者和消费者开始运行之前完成注册，新消费者从当前写位置开始读
+    size_t addConsumer(const std::vector<size_t>& dependsOn = {});
+    size_t getConsumerCount() const noexcept;
+
+    // 生产者操作：最慢的末端消费者落后一整圈时返回 false
+    bool push(const T& item);
+    bool push(T&& item);
+    size_t pushMultiple(const T* items, size_t num);
+
+    // 消费者操作（每个编号只能由一个线程使用）
+    // 原地对当前可读的元素依次调用 f(const T&)，整批结束后只发布一次游标
+    template <typename F>
+    size_t consume(size_t consumer, F&& f);
+    template <typename F>
+    size_t consume_up_to(size_t consumer, size_t num, F&& f);
+    bool pop(size_t consumer, T& item);  // 拷贝出一个元素
+    size_t available(size_t consumer) const;
+
+    // 状态查询（并发时为近似值）
+    size_t getCapacity() const noexcept;
+    uint64_t getPublishedCount() const noexcept;
+};
+
+#include "BroadcastRingBuffer.cpp"
+
+#endif // BROADCASTRINGBUFFER_HPP
@@ -0,0 +1,189 @@
+#ifndef BYTERINGBUFFER_CPP
+#define BYTERINGBUFFER_CPP
+
+#include "ByteRingBuffer.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// 非模板类的实现也随头文件一起包含，因此所有成员都声明为 inline
+
+inline ByteRingBuffer::ByteRingBuffer(size_t size)
+    : buffer(nullptr), capacity(0), mask(0), head(0), tail(0), mirrored(false) {
+    if (size == 0) {
+        throw std::invalid_argument("ByteRingBuffer size must be greater than 0");
+    }
+
+    size_t rounded = std::bit_ceil(size);
+#if defined(__linux__)
+    const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    rounded = std::max(rounded, page);
+    mirrored = mapMirrored(rounded);
+#endif
+    if (!mirrored) {
+        buffer = new char[rounded];
+    }
+    capacity = rounded;
+    mask = capacity - 1;
+}
+
+// 预留 2 * size 的地址空间，再把同一个 memfd 分别固定映射到前后两半
+inline bool ByteRingBuffer::mapMirrored(size_t size) {
+#if defined(__linux__)
+    const int fd = memfd_create("ByteRingBuffer", MFD_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return false;
+    }
+
+    void* base = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+
+    char* lower = static_cast<char*>(base);
+    void* first = mmap(lower, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void* second = mmap(lower + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);  // 映射会保持文件存活
+    if (first == MAP_FAILED || second == MAP_FAILED) {
+        munmap(base, 2 * size);
+        return false;
+    }
+
+    buffer = lower;
+    return true;
+#else
+    (void)size;
+    return false;
+#endif
+}
+
+inline void ByteRingBuffer::release() noexcept {
+    if (!buffer) {
+        return;
+    }
+#if defined(__linux__)
+    if (mirrored) {
+        munmap(buffer, 2 * capacity);
+        buffer = nullptr;
+        return;
+    }
+#endif
+    delete[] buffer;
+    buffer = nullptr;
+}
+
+inline ByteRingBuffer::~ByteRingBuffer() {
+    release();
+}
+
+inline ByteRingBuffer::ByteRingBuffer(ByteRingBuffer&& other) noexcept
+    : buffer(std::exchange(other.buffer, nullptr)), capacity(std::exchange(other.capacity, 0)),
+      mask(std::exchange(other.mask, 0)), head(std::exchange(other.head, 0)),
+      tail(std::exchange(other.tail, 0)), mirrored(std::exchange(other.mirrored, false)) {}
+
+inline ByteRingBuffer& ByteRingBuffer::operator=(ByteRingBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        buffer = std::exchange(other.buffer, nullptr);
+        capacity = std::exchange(other.capacity, 0);
+        mask = std::exchange(other.mask, 0);
+        head = std::exchange(other.head, 0);
+        tail = std::exchange(other.tail, 0);
+        mirrored = std::exchange(other.mirrored, false);
+    }
+    return *this;
+}
+
+inline size_t ByteRingBuffer::write(const void* data, size_t len) {
+    const size_t n = std::min(len, capacity - size());
+    const size_t start = tail & mask;
+    const auto* src = static_cast<const char*>(data);
+    if (mirrored) {
+        std::memcpy(buffer + start, src, n);  // 跨越末尾的部分落在镜像页上
+    } else {
+        const size_t first = std::min(n, capacity - start);
+        std::memcpy(buffer + start, src, first);
+        std::memcpy(buffer, src + first, n - first);
+    }
+    tail += n;
+    return n;
+}
+
+inline size_t ByteRingBuffer::read(void* data, size_t len) {
+    const size_t n = std::min(len, size());
+    const size_t start = head & mask;
+    auto* dst = static_cast<char*>(data);
+    if (mirrored) {
+        std::memcpy(dst, buffer + start, n);
+    } else {
+        const size_t first = std::min(n, capacity - start);
+        std::memcpy(dst, buffer + start, first);
+        std::memcpy(dst + first, buffer, n - first);
+    }
+    head += n;
+    return n;
+}
+
+inline std::span<char> ByteRingBuffer::writable() noexcept {
+    const size_t start = tail & mask;
+    const size_t space = capacity - size();
+    return {buffer + start, mirrored ? space : std::min(space, capacity - start)};
+}
+
+inline void ByteRingBuffer::commit(size_t len) {
+    if (len > capacity - size()) {
+        throw std::out_of_range("ByteRingBuffer commit exceeds free space");
+    }
+    tail += len;
+}
+
+inline std::string_view ByteRingBuffer::readable() const noexcept {
+    const size_t start = head & mask;
+    const size_t n = size();
+    return {buffer + start, mirrored ? n : std::min(n, capacity - start)};
+}
+
+inline void ByteRingBuffer::consume(size_t len) {
+    if (len > size()) {
+        throw std::out_of_range("ByteRingBuffer consume exceeds readable bytes");
+    }
+    head += len;
+}
+
+inline bool ByteRingBuffer::isMirrored() const noexcept {
+    return mirrored;
+}
+
+inline bool ByteRingBuffer::isEmpty() const noexcept {
+    return tail == head;
+}
+
+inline bool ByteRingBuffer::isFull() const noexcept {
+    return tail - head == capacity;
+}
+
+inline size_t ByteRingBuffer::size() const noexcept {
+    return tail - head;
+}
+
+inline size_t ByteRingBuffer::getCapacity() const noexcept {
+    return capacity;
+}
+
+inline void ByteRingBuffer::clear() noexcept {
+    head = 0;
+    tail = 0;
+}
+
+#endif // BYTERINGBUFFER_CPP
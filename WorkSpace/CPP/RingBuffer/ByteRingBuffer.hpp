@@ -0,0 +1,57 @@
+#ifndef BYTERINGBUFFER_HPP
+#define BYTERINGBUFFER_HPP
+
+#include <stdexcept>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+// 字节流专用环形缓冲区（面向分帧器、协议解析器）
+// Linux 下把同一块 memfd 内存连续映射两次：第 i 字节和第 i + capacity 字节是同一物理页，
+// 因此任何可读/可写区域都是一段连续地址，可以直接交给 string_view、memchr、memcpy。
+// 映射失败（或非 Linux 平台）时退化为普通单次分配的环形布局，此时区域可能被切成两段。
+class ByteRingBuffer {
+private:
+    char* buffer;
+    size_t capacity;   // 镜像模式下为页大小的整数倍
+    size_t mask;       // 镜像模式下容量为 2 的幂
+    size_t head;       // 自由递增的读计数
+    size_t tail;       // 自由递增的写计数
+    bool mirrored;
+
+    bool mapMirrored(size_t size);
+    void release() noexcept;
+
+public:
+    // 构造函数：容量向上取整为 2 的幂（且不小于一页）
+    explicit ByteRingBuffer(size_t size);
+    ~ByteRingBuffer();
+
+    ByteRingBuffer(const ByteRingBuffer&) = delete;
+    ByteRingBuffer& operator=(const ByteRingBuffer&) = delete;
+    ByteRingBuffer(ByteRingBuffer&& other) noexcept;
+    ByteRingBuffer& operator=(ByteRingBuffer&& other) noexcept;
+
+    // 拷贝式读写，返回实际处理的字节数
+    size_t write(const void* data, size_t len);
+    size_t read(void* data, size_t len);
+
+    // 零拷贝读写：镜像模式下返回的区域总是覆盖全部可读/可写字节；
+    // 退化模式下只返回到缓冲区末尾为止的第一段
+    std::span<char> writable() noexcept;
+    void commit(size_t len);
+    std::string_view readable() const noexcept;
+    void consume(size_t len);
+
+    // 状态查询
+    bool isMirrored() const noexcept;
+    bool isEmpty() const noexcept;
+    bool isFull() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+    void clear() noexcept;
+};
+
+#include "ByteRingBuffer.cpp"
+
+#endif // BYTERINGBUFFER_HPP
@@ -0,0 +1,104 @@
+#ifndef FLIGHTRECORDER_CPP
+#define FLIGHTRECORDER_CPP
+
+#include "FlightRecorder.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+template <typename T>
+FlightRecorder<T>::FlightRecorder(size_t size) : tail(0) {
+    if (size == 0) {
+        throw std::invalid_argument("FlightRecorder size must be greater than 0");
+    }
+    capacity = std::bit_ceil(size);
+    mask = capacity - 1;
+    buffer = std::make_unique<Slot[]>(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        buffer[i].sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+void FlightRecorder<T>::push(const T& item) noexcept {
+    uint64_t words[WORDS] = {};
+    std::memcpy(words, &item, sizeof(T));
+
+    const size_t pos = tail.load(std::memory_order_relaxed);
+    Slot& slot = buffer[pos & mask];
+
+    // 先标记为“写入中”，release 栅栏保证读线程看到新数据时也能看到该标记
+    slot.sequence.store(2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(2 * pos + 2, std::memory_order_release);
+    tail.store(pos + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool FlightRecorder<T>::readSlot(size_t pos, T& item) const noexcept {
+    const Slot& slot = buffer[pos & mask];
+    const size_t expected = 2 * pos + 2;
+    if (slot.sequence.load(std::memory_order_acquire) != expected) {
+        return false;
+    }
+
+    uint64_t words[WORDS];
+    for (size_t i = 0; i < WORDS; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+        return false;  // 读取过程中被写线程覆盖
+    }
+
+    std::memcpy(&item, words, sizeof(T));
+    return true;
+}
+
+template <typename T>
+size_t FlightRecorder<T>::snapshot(std::vector<T>& out) const {
+    const size_t t = tail.load(std::memory_order_acquire);
+    const size_t n = std::min(t, capacity);
+
+    // 从最新往最旧读，遇到第一个被覆盖的槽位就停止，保证结果连续
+    out.resize(n);
+    size_t got = 0;
+    while (got < n && readSlot(t - 1 - got, out[n - 1 - got])) {
+        ++got;
+    }
+    out.erase(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(n - got));
+    return got;
+}
+
+template <typename T>
+std::vector<T> FlightRecorder<T>::snapshot() const {
+    std::vector<T> out;
+    snapshot(out);
+    return out;
+}
+
+template <typename T>
+size_t FlightRecorder<T>::getTotalPushed() const noexcept {
+    return tail.load(std::memory_order_acquire);
+}
+
+template <typename T>
+size_t FlightRecorder<T>::getDroppedCount() const noexcept {
+    const size_t t = tail.load(std::memory_order_acquire);
+    return t > capacity ? t - capacity : 0;
+}
+
+template <typename T>
+size_t FlightRecorder<T>::size() const noexcept {
+    return std::min(tail.load(std::memory_order_acquire), capacity);
+}
+
+template <typename T>
+size_t FlightRecorder<T>::getCapacity() const noexcept {
+    return capacity;
+}
+
+#endif // FLIGHTRECORDER_CPP
@@ -0,0 +1,67 @@
+#ifndef FLIGHTRECORDER_HPP
+#define FLIGHTRECORDER_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// 覆盖式环形缓冲区的并发版本（飞行记录仪）
+// 一个写线程不停 push，永远不会失败，最旧的元素被直接覆盖；
+// 任意多个读线程随时可以 snapshot 取得“最新 N 个”的一致快照，不阻塞写线程。
+// 每个槽位是一个 seqlock：读线程读取前后校验序号，被覆盖的槽位会被丢弃。
+template <typename T>
+class FlightRecorder {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "FlightRecorder requires a trivially copyable element type");
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // 数据按 64 位字存放在原子变量中，读写并发时不构成数据竞争
+    struct Slot {
+        std::atomic<size_t> sequence;  // 2*pos+1：正在写入；2*pos+2：位置 pos 写入完成
+        std::atomic<uint64_t> words[WORDS];
+    };
+
+    std::unique_ptr<Slot[]> buffer;
+    size_t capacity;
+    size_t mask;
+
+    // 已发布的写入总数（只有写线程修改）
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail;
+
+    // 读取位置 pos 的元素，若已被覆盖或尚未写完返回 false
+    bool readSlot(size_t pos, T& item) const noexcept;
+
+public:
+    // 构造函数（size 会向上取整为 2 的幂）
+    explicit FlightRecorder(size_t size);
+
+    ~FlightRecorder() = default;
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    // 写线程：O(1)，缓冲区满时覆盖最旧的元素
+    void push(const T& item) noexcept;
+
+    // 读线程：按从旧到新的顺序把最新的元素写入 out（先清空 out），返回元素个数。
+    // 结果是以某一时刻的最新元素结尾的连续序列，期间被覆盖的旧元素会被截掉。
+    size_t snapshot(std::vector<T>& out) const;
+    std::vector<T> snapshot() const;
+
+    // 状态查询
+    size_t getTotalPushed() const noexcept;
+    size_t getDroppedCount() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+};
+
+#include "FlightRecorder.cpp"
+
+#endif // FLIGHTRECORDER_HPP
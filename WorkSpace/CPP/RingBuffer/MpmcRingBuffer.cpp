@@ -0,0 +1,251 @@
+#ifndef MPMCRINGBUFFER_CPP
+#define MPMCRINGBUFFER_CPP
+
+#include "MpmcRingBuffer.hpp"
+#include <bit>
+#include <utility>
+
+template <typename T>
+MpmcRingBuffer<T>::MpmcRingBuffer(size_t size)
+    : enqueuePos(0), dequeuePos(0), closed(false) {
+    if (size == 0) {
+        throw std::invalid_argument("MpmcRingBuffer size must be greater than 0");
+    }
+    capacity = std::bit_ceil(size);
+    mask = capacity - 1;
+    buffer = std::make_unique<Slot[]>(capacity);
+    // 槽位 i 初始序号为 i，表示“可供第 i 次 push 写入”
+    for (size_t i = 0; i < capacity; ++i) {
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// 槽位序号约定（pos 为自由递增的位置计数）：
+//   sequence == pos           该槽位空闲，可被位置 pos 的生产者写入
+//   sequence == pos + 1       该槽位已写入，可被位置 pos 的消费者读取
+//   sequence == pos + cap     该槽位已读出，等待下一轮生产者
+template <typename T>
+typename MpmcRingBuffer<T>::Slot* MpmcRingBuffer<T>::claimForPush(size_t& pos) {
+    pos = enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = buffer[pos & mask];
+        const size_t seq = slot.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;  // 上一轮的消费者还没读走：已满
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+typename MpmcRingBuffer<T>::Slot* MpmcRingBuffer<T>::claimForPop(size_t& pos) {
+    pos = dequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = buffer[pos & mask];
+        const size_t seq = slot.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;  // 生产者还没写入：已空
+        } else {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::push(const T& item) {
+    size_t pos;
+    Slot* slot = claimForPush(pos);
+    if (!slot) {
+        return false;
+    }
+
+    slot->data = item;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    notEmpty.notify();
+    return true;
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::push(T&& item) {
+    size_t pos;
+    Slot* slot = claimForPush(pos);
+    if (!slot) {
+        return false;
+    }
+
+    slot->data = std::move(item);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    notEmpty.notify();
+    return true;
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::pop(T& item) {
+    size_t pos;
+    Slot* slot = claimForPop(pos);
+    if (!slot) {
+        return false;
+    }
+
+    item = std::move(slot->data);
+    slot->sequence.store(pos + capacity, std::memory_order_release);
+    notFull.notify();
+    return true;
+}
+
+template <typename T>
+std::optional<T> MpmcRingBuffer<T>::pop() {
+    size_t pos;
+    Slot* slot = claimForPop(pos);
+    if (!slot) {
+        return std::nullopt;
+    }
+
+    T item = std::move(slot->data);
+    slot->sequence.store(pos + capacity, std::memory_order_release);
+    notFull.notify();
+    return item;
+}
+
+// ---------------------------------------------------------------------------
+// 阻塞操作：就绪判断用 isEmpty / isFull（比较入队、出队位置的快照），只读不抢占槽位；
+// 判断为就绪后仍可能被其他线程抢先，因此循环重试 push / pop
+// ---------------------------------------------------------------------------
+template <typename T>
+bool MpmcRingBuffer<T>::push_wait(const T& item) {
+    for (;;) {
+        if (closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (push(item)) {
+            return true;
+        }
+        notFull.waitUntil([this] {
+            return !isFull() || closed.load(std::memory_order_acquire);
+        });
+    }
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::push_wait(T&& item) {
+    for (;;) {
+        if (closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (push(std::move(item))) {  // 失败时 item 不会被移走
+            return true;
+        }
+        notFull.waitUntil([this] {
+            return !isFull() || closed.load(std::memory_order_acquire);
+        });
+    }
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::waitForData(const std::chrono::steady_clock::time_point* deadline) {
+    return notEmpty.waitUntil([this] {
+        return !isEmpty() || closed.load(std::memory_order_acquire);
+    }, deadline);
+}
+
+template <typename T>
+std::optional<T> MpmcRingBuffer<T>::pop_wait() {
+    for (;;) {
+        if (auto item = pop()) {
+            return item;
+        }
+        if (closed.load(std::memory_order_acquire)) {
+            return pop();
+        }
+        waitForData(nullptr);
+    }
+}
+
+template <typename T>
+template <typename Rep, typename Period>
+std::optional<T> MpmcRingBuffer<T>::pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+    for (;;) {
+        if (auto item = pop()) {
+            return item;
+        }
+        if (closed.load(std::memory_order_acquire) || !waitForData(&deadline)) {
+            return pop();
+        }
+    }
+}
+
+template <typename T>
+size_t MpmcRingBuffer<T>::pop_wait_multiple(T* items, size_t num) {
+    if (num == 0) {
+        return 0;
+    }
+    for (;;) {
+        size_t n = 0;
+        while (n < num && pop(items[n])) {
+            ++n;
+        }
+        if (n > 0) {
+            return n;
+        }
+        if (closed.load(std::memory_order_acquire)) {
+            while (n < num && pop(items[n])) {
+                ++n;
+            }
+            return n;
+        }
+        waitForData(nullptr);
+    }
+}
+
+template <typename T>
+void MpmcRingBuffer<T>::close() noexcept {
+    closed.store(true, std::memory_order_release);
+    notEmpty.notifyAll();
+    notFull.notifyAll();
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::isClosed() const noexcept {
+    return closed.load(std::memory_order_acquire);
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::isEmpty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+bool MpmcRingBuffer<T>::isFull() const noexcept {
+    return size() == capacity;
+}
+
+template <typename T>
+size_t MpmcRingBuffer<T>::size() const noexcept {
+    const size_t deq = dequeuePos.load(std::memory_order_acquire);
+    const size_t enq = enqueuePos.load(std::memory_order_acquire);
+    // 两次读取之间可能有竞争，结果截断到 [0, capacity]
+    if (enq <= deq) {
+        return 0;
+    }
+    return enq - deq < capacity ? enq - deq : capacity;
+}
+
+template <typename T>
+size_t MpmcRingBuffer<T>::getCapacity() const noexcept {
+    return capacity;
+}
+
+#endif // MPMCRINGBUFFER_CPP
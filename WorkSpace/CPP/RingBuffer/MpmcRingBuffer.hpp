@@ -0,0 +1,86 @@
+#ifndef MPMCRINGBUFFER_HPP
+#define MPMCRINGBUFFER_HPP
+
+#include "WaitSignal.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+// 有界多生产者/多消费者（MPMC）无锁队列
+// 每个槽位带一个序号（sequence）：生产者只在 enqueuePos 上竞争，
+// 消费者只在 dequeuePos 上竞争，双方通过槽位序号交接数据。
+// 容量向上取整为 2 的幂，下标用掩码回绕。
+template <typename T>
+class MpmcRingBuffer {
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    // 只读共享数据：构造后不再修改
+    std::unique_ptr<Slot[]> buffer;
+    size_t capacity;
+    size_t mask;
+
+    // 生产者之间竞争的位置
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos;
+
+    // 消费者之间竞争的位置
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos;
+
+    // 阻塞接口使用的等待信号：只有线程真正休眠时才会被写入
+    alignas(CACHE_LINE_SIZE) WaitSignal notEmpty;  // 消费者等待，生产者通知
+    WaitSignal notFull;                            // 生产者等待，消费者通知
+    std::atomic<bool> closed;
+
+    // 抢占一个可写槽位，失败（已满）返回 nullptr
+    Slot* claimForPush(size_t& pos);
+    // 抢占一个可读槽位，失败（已空）返回 nullptr
+    Slot* claimForPop(size_t& pos);
+    bool waitForData(const std::chrono::steady_clock::time_point* deadline);
+
+public:
+    // 构造函数（size 会向上取整为 2 的幂）
+    explicit MpmcRingBuffer(size_t size);
+
+    ~MpmcRingBuffer() = default;
+
+    // 原子变量不可拷贝也不可移动
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer(MpmcRingBuffer&&) = delete;
+    MpmcRingBuffer& operator=(MpmcRingBuffer&&) = delete;
+
+    // 核心操作（任意线程均可调用）
+    bool push(const T& item);
+    bool push(T&& item);
+    bool pop(T& item);
+    std::optional<T> pop();
+
+    // 阻塞操作：先短暂自旋，再休眠等待唤醒（语义同 SpscRingBuffer）
+    bool push_wait(const T& item);
+    bool push_wait(T&& item);
+    std::optional<T> pop_wait();
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout);
+    size_t pop_wait_multiple(T* items, size_t num);
+
+    void close() noexcept;
+    bool isClosed() const noexcept;
+
+    // 状态查询（并发时为近似值）
+    bool isEmpty() const noexcept;
+    bool isFull() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+};
+
+#include "MpmcRingBuffer.cpp"
+
+#endif // MPMCRINGBUFFER_HPP
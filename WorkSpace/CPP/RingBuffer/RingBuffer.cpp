@@ -3,186 +3,586 @@
 
 #include "RingBuffer.hpp"
 #include <algorithm>
+#include <cstdint>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
-template <typename T>
-RingBuffer<T>::RingBuffer(size_t size) 
-    : buffer(std::make_unique<T[]>(size)), 
-      capacity(size), head(0), tail(0), count(0) {
+template <typename T, typename Allocator, typename Stats>
+RingBuffer<T, Allocator, Stats>::RingBuffer(size_t size, bool roundToPowerOfTwo,
+                                     const Allocator& allocator)
+    : alloc(allocator), buffer(nullptr),
+      capacity(roundToPowerOfTwo ? std::bit_ceil(size) : size),
+      head(0), tail(0), reserved(0), policy(OverflowPolicy::Reject), dropped(0),
+      baseCapacity(capacity), maxCapacity(SIZE_MAX), stats() {
     if (size == 0) {
         throw std::invalid_argument("RingBuffer size must be greater than 0");
     }
+    // 只分配存储，不构造任何元素
+    buffer = AllocTraits::allocate(alloc, capacity);
+    masked = std::has_single_bit(capacity);
+    mask = capacity - 1;
+    stats.attach(capacity);
 }
 
-template <typename T>
-bool RingBuffer<T>::push(const T& item) {
-    if (isFull()) {
+template <typename T, typename Allocator, typename Stats>
+RingBuffer<T, Allocator, Stats>::~RingBuffer() {
+    release();
+}
+
+template <typename T, typename Allocator, typename Stats>
+RingBuffer<T, Allocator, Stats>::RingBuffer(RingBuffer&& other) noexcept
+    : alloc(std::move(other.alloc)), buffer(std::exchange(other.buffer, nullptr)),
+      capacity(std::exchange(other.capacity, 0)), mask(std::exchange(other.mask, 0)),
+      masked(std::exchange(other.masked, true)), head(std::exchange(other.head, 0)),
+      tail(std::exchange(other.tail, 0)), reserved(std::exchange(other.reserved, 0)),
+      policy(other.policy), dropped(std::exchange(other.dropped, 0)),
+      baseCapacity(std::exchange(other.baseCapacity, 0)), maxCapacity(other.maxCapacity),
+      stats(std::move(other.stats)) {}
+
+template <typename T, typename Allocator, typename Stats>
+RingBuffer<T, Allocator, Stats>& RingBuffer<T, Allocator, Stats>::operator=(RingBuffer&& other) noexcept {
+    if (this != &other) {
+        RingBuffer moved(std::move(other));
+        swap(moved);  // 原有元素随 moved 一起析构
+    }
+    return *this;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::swap(RingBuffer& other) noexcept {
+    using std::swap;
+    swap(alloc, other.alloc);
+    swap(buffer, other.buffer);
+    swap(capacity, other.capacity);
+    swap(mask, other.mask);
+    swap(masked, other.masked);
+    swap(head, other.head);
+    swap(tail, other.tail);
+    swap(reserved, other.reserved);
+    swap(policy, other.policy);
+    swap(dropped, other.dropped);
+    swap(baseCapacity, other.baseCapacity);
+    swap(maxCapacity, other.maxCapacity);
+    swap(stats, other.stats);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::release() noexcept {
+    if (!buffer) {
+        return;
+    }
+    destroyRange(head, tail + reserved);
+    AllocTraits::deallocate(alloc, buffer, capacity);
+    buffer = nullptr;
+}
+
+// head/tail 从不回绕，只在访问槽位时取下标；
+// 非 2 的幂容量仍需取模（计数要 2^64 次操作后才会溢出）
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::slot(size_t pos) const noexcept {
+    return masked ? (pos & mask) : (pos % capacity);
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::constructRange(const T* src, size_t n, T* dst) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n > 0) {
+            std::memcpy(dst, src, n * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                AllocTraits::construct(alloc, dst + i, src[i]);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                AllocTraits::destroy(alloc, dst + j);
+            }
+            throw;
+        }
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::moveRange(T* src, size_t n, T* dst) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n > 0) {
+            std::memcpy(dst, src, n * sizeof(T));
+        }
+    } else {
+        std::move(src, src + n, dst);
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::destroyRange(size_t from, size_t to) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_t pos = from; pos != to; ++pos) {
+            AllocTraits::destroy(alloc, buffer + slot(pos));
+        }
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::recordPop(size_t popped, size_t requested) noexcept {
+    if (popped > 0) {
+        stats.onPop(head - popped, popped, size());
+    } else if (requested > 0) {
+        stats.onPopFailed();
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::makeRoom(size_t num) {
+    const size_t space = capacity - size();
+    if (num > space && policy == OverflowPolicy::Grow) {
+        growFor(size() + num);
+        return std::min(num, capacity - size());
+    }
+    if (num <= space || policy == OverflowPolicy::Reject) {
+        return std::min(num, space);
+    }
+
+    // 覆盖模式：head 前移即可丢弃最旧的元素，O(1) 不需要逐个 pop
+    const size_t n = std::min(num, capacity);
+    const size_t drop = n - space;
+    destroyRange(head, head + drop);
+    head += drop;
+    dropped += drop;
+    stats.onDrop(drop);
+    return n;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::growFor(size_t required) {
+    const size_t limit = std::max(maxCapacity, capacity);
+    if (required <= capacity || capacity == limit) {
+        return;
+    }
+    // 几何增长保证均摊 O(1)；2 的幂容量翻倍后仍是 2 的幂，掩码下标不受影响
+    size_t newCapacity = std::max<size_t>(capacity, 1);
+    while (newCapacity < required && newCapacity <= limit / 2) {
+        newCapacity *= 2;
+    }
+    if (newCapacity < required) {
+        newCapacity = limit;
+    }
+    reallocate(std::min(newCapacity, limit));
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::reallocate(size_t newCapacity) {
+    // reserve 后尚未 commit 的槽位一起搬走
+    const size_t live = size() + reserved;
+    T* newBuffer = AllocTraits::allocate(alloc, newCapacity);
+
+    const size_t start = capacity == 0 ? 0 : slot(head);
+    const size_t first = std::min(live, capacity - start);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (live > 0) {
+            std::memcpy(newBuffer, buffer + start, first * sizeof(T));
+            std::memcpy(newBuffer + first, buffer, (live - first) * sizeof(T));
+        }
+    } else {
+        // 移动构造不抛异常时移动，否则拷贝，失败时原缓冲区保持不变
+        size_t i = 0;
+        try {
+            for (; i < live; ++i) {
+                T& src = i < first ? buffer[start + i] : buffer[i - first];
+                AllocTraits::construct(alloc, newBuffer + i, std::move_if_noexcept(src));
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                AllocTraits::destroy(alloc, newBuffer + j);
+            }
+            AllocTraits::deallocate(alloc, newBuffer, newCapacity);
+            throw;
+        }
+        destroyRange(head, head + live);
+    }
+    if (buffer) {
+        AllocTraits::deallocate(alloc, buffer, capacity);
+    }
+
+    buffer = newBuffer;
+    capacity = newCapacity;
+    masked = std::has_single_bit(capacity);
+    mask = capacity - 1;
+    tail = live - reserved;
+    head = 0;
+    stats.attach(capacity);
+}
+
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::push(const T& item) {
+    if (makeRoom(1) == 0) {
+        stats.onPushFailed(1);
         return false;
     }
-    
-    buffer[tail] = item;
-    tail = (tail + 1) % capacity;
-    ++count;
+
+    AllocTraits::construct(alloc, buffer + slot(tail), item);
+    ++tail;
+    stats.onPush(tail - 1, 1, size());
     return true;
 }
 
-template <typename T>
-bool RingBuffer<T>::push(T&& item) {
-    if (isFull()) {
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::push(T&& item) {
+    if (makeRoom(1) == 0) {
+        stats.onPushFailed(1);
         return false;
     }
-    
-    buffer[tail] = std::move(item);
-    tail = (tail + 1) % capacity;
-    ++count;
+
+    AllocTraits::construct(alloc, buffer + slot(tail), std::move(item));
+    ++tail;
+    stats.onPush(tail - 1, 1, size());
     return true;
 }
 
-template <typename T>
-bool RingBuffer<T>::pop(T& item) {
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::pop(T& item) {
     if (isEmpty()) {
+        stats.onPopFailed();
         return false;
     }
-    
-    item = buffer[head];
-    head = (head + 1) % capacity;
-    --count;
+
+    T* p = buffer + slot(head);
+    item = std::move(*p);
+    AllocTraits::destroy(alloc, p);  // 立即释放元素持有的资源
+    ++head;
+    stats.onPop(head - 1, 1, size());
     return true;
 }
 
-template <typename T>
-bool RingBuffer<T>::peek(T& item) const {
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::peek(T& item) const {
     if (isEmpty()) {
         return false;
     }
-    
-    item = buffer[head];
+
+    item = buffer[slot(head)];
     return true;
 }
 
-template <typename T>
-std::optional<T> RingBuffer<T>::pop() {
+template <typename T, typename Allocator, typename Stats>
+std::optional<T> RingBuffer<T, Allocator, Stats>::pop() {
     if (isEmpty()) {
+        stats.onPopFailed();
         return std::nullopt;
     }
-    
-    T item = std::move(buffer[head]);
-    head = (head + 1) % capacity;
-    --count;
+
+    T* p = buffer + slot(head);
+    std::optional<T> item(std::move(*p));
+    AllocTraits::destroy(alloc, p);
+    ++head;
+    stats.onPop(head - 1, 1, size());
     return item;
 }
 
-template <typename T>
-std::optional<T> RingBuffer<T>::peek() const {
+template <typename T, typename Allocator, typename Stats>
+std::optional<T> RingBuffer<T, Allocator, Stats>::peek() const {
     if (isEmpty()) {
         return std::nullopt;
     }
-    
-    return buffer[head];
+
+    return buffer[slot(head)];
 }
 
-template <typename T>
-bool RingBuffer<T>::isEmpty() const noexcept {
-    return count == 0;
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::isEmpty() const noexcept {
+    return tail == head;
 }
 
-template <typename T>
-bool RingBuffer<T>::isFull() const noexcept {
-    return count == capacity;
+template <typename T, typename Allocator, typename Stats>
+bool RingBuffer<T, Allocator, Stats>::isFull() const noexcept {
+    return tail - head == capacity;
 }
 
-template <typename T>
-size_t RingBuffer<T>::size() const noexcept {
-    return count;
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::size() const noexcept {
+    return tail - head;
 }
 
-template <typename T>
-size_t RingBuffer<T>::getCapacity() const noexcept {
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::getCapacity() const noexcept {
     return capacity;
 }
 
-template <typename T>
-void RingBuffer<T>::clear() noexcept {
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::setOverflowPolicy(OverflowPolicy newPolicy) noexcept {
+    policy = newPolicy;
+}
+
+template <typename T, typename Allocator, typename Stats>
+OverflowPolicy RingBuffer<T, Allocator, Stats>::getOverflowPolicy() const noexcept {
+    return policy;
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::getDroppedCount() const noexcept {
+    return dropped;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::setMaxCapacity(size_t limit) noexcept {
+    maxCapacity = limit;
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::getMaxCapacity() const noexcept {
+    return maxCapacity;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::shrink_to_fit() {
+    size_t target = std::max(size() + reserved, baseCapacity);
+    if (masked) {
+        target = std::bit_ceil(target);
+    }
+    if (target < capacity) {
+        reallocate(target);
+    }
+}
+
+template <typename T, typename Allocator, typename Stats>
+Stats& RingBuffer<T, Allocator, Stats>::getStats() noexcept {
+    return stats;
+}
+
+template <typename T, typename Allocator, typename Stats>
+const Stats& RingBuffer<T, Allocator, Stats>::getStats() const noexcept {
+    return stats;
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::clear() noexcept {
+    // 只析构活跃区间，其余槽位本来就未初始化
+    destroyRange(head, tail + reserved);
     head = 0;
     tail = 0;
-    count = 0;
+    reserved = 0;
 }
 
-template <typename T>
-size_t RingBuffer<T>::pushMultiple(const T* items, size_t num) {
-    size_t pushed = 0;
-    for (size_t i = 0; i < num && !isFull(); ++i) {
-        if (push(items[i])) {
-            ++pushed;
+// 零拷贝操作
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::template SpanPair<T>
+RingBuffer<T, Allocator, Stats>::reserve(size_t num) {
+    if (policy == OverflowPolicy::Grow) {
+        growFor(size() + num);
+    }
+    const size_t n = std::min(num, capacity - size());
+
+    // 交给调用方写入的槽位必须是活对象；平凡类型无需构造
+    if constexpr (!std::is_trivially_default_constructible_v<T>) {
+        for (; reserved < n; ++reserved) {
+            AllocTraits::construct(alloc, buffer + slot(tail + reserved));
         }
+        destroyRange(tail + n, tail + reserved);
     }
-    return pushed;
+    reserved = n;
+
+    const size_t start = slot(tail);
+    const size_t first = std::min(n, capacity - start);
+    return {std::span<T>(buffer + start, first),
+            std::span<T>(buffer, n - first)};
 }
 
-template <typename T>
-size_t RingBuffer<T>::pushMultiple(const std::vector<T>& items) {
-    return pushMultiple(items.data(), items.size());
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::commit(size_t num) {
+    if (num > reserved) {
+        throw std::out_of_range("RingBuffer commit exceeds reserved slots");
+    }
+    destroyRange(tail + num, tail + reserved);  // 未提交的槽位恢复为未初始化
+    tail += num;
+    reserved = 0;
+    if (num > 0) {
+        stats.onPush(tail - num, num, size());
+    }
 }
 
-template <typename T>
-size_t RingBuffer<T>::popMultiple(T* items, size_t num) {
-    size_t popped = 0;
-    for (size_t i = 0; i < num && !isEmpty(); ++i) {
-        if (pop(items[i])) {
-            ++popped;
-        }
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::template SpanPair<const T>
+RingBuffer<T, Allocator, Stats>::readable() const noexcept {
+    const size_t n = size();
+    const size_t start = slot(head);
+    const size_t first = std::min(n, capacity - start);
+    return {std::span<const T>(buffer + start, first),
+            std::span<const T>(buffer, n - first)};
+}
+
+template <typename T, typename Allocator, typename Stats>
+void RingBuffer<T, Allocator, Stats>::consume(size_t num) {
+    if (num > size()) {
+        throw std::out_of_range("RingBuffer consume exceeds readable elements");
+    }
+    destroyRange(head, head + num);
+    head += num;
+    if (num > 0) {
+        stats.onPop(head - num, num, size());
     }
-    return popped;
 }
 
-template <typename T>
-std::vector<T> RingBuffer<T>::popMultiple(size_t num) {
+template <typename T, typename Allocator, typename Stats>
+const T* RingBuffer<T, Allocator, Stats>::front() const noexcept {
+    return isEmpty() ? nullptr : buffer + slot(head);
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::pushMultiple(const T* items, size_t num) {
+    const size_t n = makeRoom(num);
+    if (n < num && policy == OverflowPolicy::Overwrite) {
+        // 批次本身超过容量：只有最后 capacity 个元素会留下
+        dropped += num - n;
+        stats.onDrop(num - n);
+        items += num - n;
+    } else if (n < num) {
+        stats.onPushFailed(num - n);
+    }
+    const size_t start = slot(tail);
+    const size_t first = std::min(n, capacity - start);
+
+    // 第一段写到缓冲区末尾，剩余部分从头开始
+    constructRange(items, first, buffer + start);
+    try {
+        constructRange(items + first, n - first, buffer);
+    } catch (...) {
+        destroyRange(tail, tail + first);
+        throw;
+    }
+    tail += n;
+    if (n > 0) {
+        stats.onPush(tail - n, n, size());
+    }
+    return n;
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::pushMultiple(const std::vector<T>& items) {
+    return pushMultiple(items.data(), items.size());
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::popMultiple(T* items, size_t num) {
+    const size_t n = std::min(num, size());
+    const size_t start = slot(head);
+    const size_t first = std::min(n, capacity - start);
+
+    moveRange(buffer + start, first, items);
+    moveRange(buffer, n - first, items + first);
+    destroyRange(head, head + n);
+    head += n;
+    recordPop(n, num);
+    return n;
+}
+
+template <typename T, typename Allocator, typename Stats>
+std::vector<T> RingBuffer<T, Allocator, Stats>::popMultiple(size_t num) {
     std::vector<T> result;
-    result.reserve(std::min(num, count));
-    
-    for (size_t i = 0; i < num && !isEmpty(); ++i) {
-        auto item = pop();
-        if (item) {
-            result.push_back(std::move(*item));
+    result.reserve(std::min(num, size()));
+    popMultiple(result, num);
+    return result;
+}
+
+template <typename T, typename Allocator, typename Stats>
+size_t RingBuffer<T, Allocator, Stats>::popMultiple(std::vector<T>& out, size_t num) {
+    const size_t n = std::min(num, size());
+    const size_t start = slot(head);
+    const size_t first = std::min(n, capacity - start);
+
+    // 区间插入对平凡可拷贝类型会退化为 memmove
+    out.clear();
+    out.insert(out.end(), std::make_move_iterator(buffer + start),
+               std::make_move_iterator(buffer + start + first));
+    out.insert(out.end(), std::make_move_iterator(buffer),
+               std::make_move_iterator(buffer + (n - first)));
+    destroyRange(head, head + n);
+    head += n;
+    recordPop(n, num);
+    return n;
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+size_t RingBuffer<T, Allocator, Stats>::consume_all(F&& f) {
+    return consume_up_to(SIZE_MAX, std::forward<F>(f));
+}
+
+template <typename T, typename Allocator, typename Stats>
+template <typename F>
+size_t RingBuffer<T, Allocator, Stats>::consume_up_to(size_t num, F&& f) {
+    const size_t n = std::min(num, size());
+    const size_t start = slot(head);
+    const size_t first = std::min(n, capacity - start);
+
+    size_t done = 0;
+    try {
+        for (; done < first; ++done) {
+            f(buffer[start + done]);
+        }
+        for (; done < n; ++done) {
+            f(buffer[done - first]);
         }
+    } catch (...) {
+        destroyRange(head, head + done);
+        head += done;
+        recordPop(done, num);
+        throw;
     }
-    
-    return result;
+    destroyRange(head, head + n);
+    head += n;
+    recordPop(n, num);
+    return n;
 }
 
 // 迭代器实现
-template <typename T>
-RingBuffer<T>::Iterator::Iterator(const RingBuffer* buffer, size_t pos)
-    : rb(buffer), position(pos) {
-    index = (rb->head + position) % rb->capacity;
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::iterator RingBuffer<T, Allocator, Stats>::begin() noexcept {
+    return iterator(buffer, capacity, slot(head), 0);
 }
 
-template <typename T>
-T& RingBuffer<T>::Iterator::operator*() const {
-    return rb->buffer[index];
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::iterator RingBuffer<T, Allocator, Stats>::end() noexcept {
+    return iterator(buffer, capacity, slot(head), size());
 }
 
-template <typename T>
-typename RingBuffer<T>::Iterator& RingBuffer<T>::Iterator::operator++() {
-    ++position;
-    index = (rb->head + position) % rb->capacity;
-    return *this;
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::const_iterator RingBuffer<T, Allocator, Stats>::begin() const noexcept {
+    return const_iterator(buffer, capacity, slot(head), 0);
 }
 
-template <typename T>
-bool RingBuffer<T>::Iterator::operator!=(const Iterator& other) const {
-    return position != other.position;
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::const_iterator RingBuffer<T, Allocator, Stats>::end() const noexcept {
+    return const_iterator(buffer, capacity, slot(head), size());
 }
 
-template <typename T>
-typename RingBuffer<T>::Iterator RingBuffer<T>::begin() const {
-    return Iterator(this, 0);
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::const_iterator RingBuffer<T, Allocator, Stats>::cbegin() const noexcept {
+    return begin();
 }
 
-template <typename T>
-typename RingBuffer<T>::Iterator RingBuffer<T>::end() const {
-    return Iterator(this, count);
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::const_iterator RingBuffer<T, Allocator, Stats>::cend() const noexcept {
+    return end();
 }
 
-#endif // RINGBUFFER_CPP
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::template SpanPair<T>
+RingBuffer<T, Allocator, Stats>::segments() noexcept {
+    const size_t n = size();
+    const size_t start = slot(head);
+    const size_t first = std::min(n, capacity - start);
+    return {std::span<T>(buffer + start, first),
+            std::span<T>(buffer, n - first)};
+}
 
+template <typename T, typename Allocator, typename Stats>
+typename RingBuffer<T, Allocator, Stats>::template SpanPair<const T>
+RingBuffer<T, Allocator, Stats>::segments() const noexcept {
+    return readable();
+}
+
+#endif // RINGBUFFER_CPP
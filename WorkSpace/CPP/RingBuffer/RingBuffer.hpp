@@ -1,35 +1,94 @@
 #ifndef RINGBUFFER_HPP
 #define RINGBUFFER_HPP
 
+#include "RingBufferStats.hpp"
 #include <stdexcept>
+#include <compare>
 #include <cstddef>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 #include <optional>
+#include <span>
 #include <vector>
 
-template <typename T>
+// 缓冲区已满时 push 的处理方式
+enum class OverflowPolicy {
+    Reject,     // 返回 false（默认）
+    Overwrite,  // 覆盖最旧的元素，始终保留最新的 capacity 个
+    Grow        // 按 2 倍扩容直到 maxCapacity，到达上限后才拒绝
+};
+
+// 槽位使用未初始化的原始内存：push 时原地构造元素，pop 时析构，
+// 构造缓冲区本身是 O(1) 的，T 也不必可默认构造。
+// Allocator 可替换为大页等自定义分配器；Stats 为统计策略（默认不统计，零开销）。
+template <typename T, typename Allocator = std::allocator<T>, typename Stats = NoRingBufferStats>
 class RingBuffer {
+    static_assert(std::is_same_v<typename Allocator::value_type, T>,
+                  "RingBuffer allocator value_type must be T");
+
 private:
-    std::unique_ptr<T[]> buffer;
+    using AllocTraits = std::allocator_traits<Allocator>;
+    
+    Allocator alloc;
+    T* buffer;        // 原始存储，只有 [head, tail) 内的槽位持有活对象
     size_t capacity;
-    size_t head;
-    size_t tail;
-    size_t count;
+    size_t mask;      // capacity - 1，仅当 capacity 为 2 的幂时有效
+    bool masked;      // capacity 是否为 2 的幂
+    size_t head;      // 自由递增的读计数
+    size_t tail;      // 自由递增的写计数（元素个数 = tail - head）
+    size_t reserved;  // reserve 后尚未 commit、已构造的槽位数
+    OverflowPolicy policy;
+    size_t dropped;   // Overwrite 模式下被覆盖丢弃的元素总数
+    size_t baseCapacity;  // 构造时的容量，shrink_to_fit 不会低于它
+    size_t maxCapacity;   // Grow 模式下的容量上限
+    [[no_unique_address]] Stats stats;
+    
+    // 把自由递增的计数映射为槽位下标
+    size_t slot(size_t pos) const noexcept;
+    
+    // 连续区间的批量操作：平凡可拷贝类型直接 memcpy
+    void constructRange(const T* src, size_t n, T* dst);  // 拷贝构造到未初始化槽位
+    static void moveRange(T* src, size_t n, T* dst);      // 移动赋值到已初始化对象
+    void destroyRange(size_t from, size_t to) noexcept;   // 析构计数区间内的元素
+    void release() noexcept;                              // 析构全部元素并归还存储
+    void swap(RingBuffer& other) noexcept;
+    // 为 num 个新元素腾出空间：Overwrite 模式下丢弃最旧的元素，
+    // Grow 模式下扩容，返回可写入的个数
+    size_t makeRoom(size_t num);
+    // Grow 模式：保证至少能容纳 required 个元素（受 maxCapacity 限制）
+    void growFor(size_t required);
+    // 换到 newCapacity 大小的新存储，元素按顺序排到槽位 0 起（至多两次批量移动）
+    void reallocate(size_t newCapacity);
+    // 批量读取后的统计：读到 0 个视为一次失败的读取
+    void recordPop(size_t popped, size_t requested) noexcept;
 
 public:
-    // 构造函数
-    explicit RingBuffer(size_t size);
+    // 环形区间最多由两段连续内存组成（第二段从缓冲区起点开始）
+    template <typename U>
+    struct SpanPair {
+        std::span<U> first;
+        std::span<U> second;
+        
+        size_t size() const noexcept { return first.size() + second.size(); }
+        bool empty() const noexcept { return size() == 0; }
+    };
+    
+    // 构造函数（roundToPowerOfTwo 为 true 时容量向上取整为 2 的幂，
+    // 下标回绕只需一次按位与，不再做整数除法）
+    explicit RingBuffer(size_t size, bool roundToPowerOfTwo = false,
+                        const Allocator& allocator = Allocator());
     
-    // 默认析构函数（智能指针自动管理内存）
-    ~RingBuffer() = default;
+    // 析构函数：只析构仍在缓冲区中的元素
+    ~RingBuffer();
     
     // 禁用拷贝构造和赋值
     RingBuffer(const RingBuffer&) = delete;
     RingBuffer& operator=(const RingBuffer&) = delete;
     
-    // 移动构造和赋值（使用默认实现）
-    RingBuffer(RingBuffer&& other) noexcept = default;
-    RingBuffer& operator=(RingBuffer&& other) noexcept = default;
+    // 移动构造和赋值（被移动的对象变为容量为 0 的空缓冲区）
+    RingBuffer(RingBuffer&& other) noexcept;
+    RingBuffer& operator=(RingBuffer&& other) noexcept;
     
     // 核心操作（返回 bool）
     bool push(const T& item);
@@ -48,28 +107,135 @@ public:
     size_t getCapacity() const noexcept;
     void clear() noexcept;
     
-    // 批量操作
+    // 溢出策略（遥测/飞行记录仪场景使用 Overwrite，突发流量使用 Grow）
+    void setOverflowPolicy(OverflowPolicy newPolicy) noexcept;
+    OverflowPolicy getOverflowPolicy() const noexcept;
+    size_t getDroppedCount() const noexcept;
+    
+    // Grow 模式的容量上限（默认不限制；只约束之后的扩容，不会立即收缩）
+    void setMaxCapacity(size_t limit) noexcept;
+    size_t getMaxCapacity() const noexcept;
+    // 突发过后收缩存储：容量降到 max(size(), 构造时容量)，2 的幂容量保持为 2 的幂。
+    // 扩容和收缩都会使迭代器、span 和 front() 返回的指针失效
+    void shrink_to_fit();
+    
+    // 统计策略（启用 RingBufferStats 时可定期 snapshot 导出）
+    Stats& getStats() noexcept;
+    const Stats& getStats() const noexcept;
+    
+    // 零拷贝操作
+    // 生产者：reserve 取得可写槽位，直接在其中写入数据，再 commit 发布
+    // （非平凡默认构造的类型会先在槽位中值初始化；reserve 与 commit 之间不要再 push）
+    SpanPair<T> reserve(size_t num);
+    void commit(size_t num);
+    // 消费者：readable 原地读取现有元素，处理完后 consume 释放
+    SpanPair<const T> readable() const noexcept;
+    void consume(size_t num);
+    // 原地查看队首元素，空时返回 nullptr
+    const T* front() const noexcept;
+    
+    // 批量操作（最多拆成两段连续区间，每批只更新一次下标；
+    // Overwrite 模式下 pushMultiple 只保留最新的 capacity 个）
     size_t pushMultiple(const T* items, size_t num);
     size_t pushMultiple(const std::vector<T>& items);
     size_t popMultiple(T* items, size_t num);
     std::vector<T> popMultiple(size_t num);
+    // 清空 out 后填入最多 num 个元素；out 预留的容量足够时不会重新分配
+    size_t popMultiple(std::vector<T>& out, size_t num);
     
-    // 迭代器支持（只读）
-    class Iterator {
+    // 批量消费：按两段连续区间原地对每个元素调用 f(T&)（f 可把元素移走），
+    // 全部处理完才统一析构并移动一次 head，返回处理的元素个数。
+    // f 抛出异常时，之前已处理的元素视为已取出，抛出异常的元素仍留在缓冲区中。
+    template <typename F>
+    size_t consume_all(F&& f);
+    template <typename F>
+    size_t consume_up_to(size_t num, F&& f);
+    
+    // 随机访问迭代器：保存起始槽位和逻辑偏移，解引用时用一次比较代替取模，
+    // 可直接用于 std::lower_bound、std::nth_element 以及并行算法
+    template <bool Const>
+    class BasicIterator {
     private:
-        const RingBuffer* rb;
-        size_t index;
-        size_t position;
+        using Pointer = std::conditional_t<Const, const T*, T*>;
+        
+        Pointer data = nullptr;
+        size_t cap = 0;
+        size_t start = 0;   // head 所在槽位
+        size_t offset = 0;  // 相对 head 的逻辑下标
+        
+        friend class RingBuffer;
+        friend class BasicIterator<!Const>;
+        
+        BasicIterator(Pointer buffer, size_t capacity, size_t first, size_t pos) noexcept
+            : data(buffer), cap(capacity), start(first), offset(pos) {}
         
     public:
-        Iterator(const RingBuffer* buffer, size_t pos);
-        T& operator*() const;
-        Iterator& operator++();
-        bool operator!=(const Iterator& other) const;
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Pointer;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        
+        BasicIterator() = default;
+        
+        // 可写迭代器可隐式转换为只读迭代器
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : data(other.data), cap(other.cap), start(other.start), offset(other.offset) {}
+        
+        reference operator*() const noexcept {
+            size_t index = start + offset;
+            if (index >= cap) {
+                index -= cap;
+            }
+            return data[index];
+        }
+        pointer operator->() const noexcept { return &**this; }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+        
+        BasicIterator& operator++() noexcept { ++offset; return *this; }
+        BasicIterator operator++(int) noexcept { BasicIterator old = *this; ++offset; return old; }
+        BasicIterator& operator--() noexcept { --offset; return *this; }
+        BasicIterator operator--(int) noexcept { BasicIterator old = *this; --offset; return old; }
+        
+        BasicIterator& operator+=(difference_type n) noexcept {
+            offset += static_cast<size_t>(n);
+            return *this;
+        }
+        BasicIterator& operator-=(difference_type n) noexcept {
+            offset -= static_cast<size_t>(n);
+            return *this;
+        }
+        friend BasicIterator operator+(BasicIterator it, difference_type n) noexcept { return it += n; }
+        friend BasicIterator operator+(difference_type n, BasicIterator it) noexcept { return it += n; }
+        friend BasicIterator operator-(BasicIterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const BasicIterator& a, const BasicIterator& b) noexcept {
+            return static_cast<difference_type>(a.offset - b.offset);
+        }
+        
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) noexcept {
+            return a.offset == b.offset;
+        }
+        friend auto operator<=>(const BasicIterator& a, const BasicIterator& b) noexcept {
+            return a.offset <=> b.offset;
+        }
     };
     
-    Iterator begin() const;
-    Iterator end() const;
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using Iterator = const_iterator;  // 兼容旧名称
+    
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+    
+    // 内容对应的两段连续内存（旧元素在前），可直接交给向量化循环
+    SpanPair<T> segments() noexcept;
+    SpanPair<const T> segments() const noexcept;
 };
 
 #include "RingBuffer.cpp"
@@ -0,0 +1,186 @@
+#ifndef RINGBUFFERSTATS_CPP
+#define RINGBUFFERSTATS_CPP
+
+#include "RingBufferStats.hpp"
+#include <algorithm>
+#include <bit>
+
+// 非模板类的实现也随头文件一起包含，因此所有成员都声明为 inline
+
+inline RingBufferStats::RingBufferStats() = default;
+
+inline RingBufferStats::RingBufferStats(const RingBufferStats& other) {
+    copyFrom(other);
+}
+
+inline RingBufferStats& RingBufferStats::operator=(const RingBufferStats& other) {
+    if (this != &other) {
+        copyFrom(other);
+    }
+    return *this;
+}
+
+inline RingBufferStats::RingBufferStats(RingBufferStats&& other) noexcept {
+    moveFrom(other);
+}
+
+inline RingBufferStats& RingBufferStats::operator=(RingBufferStats&& other) noexcept {
+    if (this != &other) {
+        moveFrom(other);
+    }
+    return *this;
+}
+
+inline void RingBufferStats::copyFrom(const RingBufferStats& other) {
+    copyCounters(other);
+    dwellSamples.reset();
+    if (other.dwellSamples) {
+        dwellSamples = std::make_unique<DwellSample[]>(DWELL_SLOTS);
+        std::copy(other.dwellSamples.get(), other.dwellSamples.get() + DWELL_SLOTS,
+                  dwellSamples.get());
+    }
+}
+
+inline void RingBufferStats::moveFrom(RingBufferStats& other) noexcept {
+    copyCounters(other);
+    dwellSamples = std::move(other.dwellSamples);
+    other.dwellEnabled = false;  // 采样槽位已被取走
+}
+
+inline void RingBufferStats::copyCounters(const RingBufferStats& other) noexcept {
+    const RingBufferStatsSnapshot s = other.snapshot();
+    capacity.store(s.capacity, std::memory_order_relaxed);
+    occupancyScale = other.occupancyScale;
+    pushes.store(s.pushes, std::memory_order_relaxed);
+    pops.store(s.pops, std::memory_order_relaxed);
+    failedPushes.store(s.failedPushes, std::memory_order_relaxed);
+    failedPops.store(s.failedPops, std::memory_order_relaxed);
+    dropped.store(s.dropped, std::memory_order_relaxed);
+    highWaterMark.store(s.highWaterMark, std::memory_order_relaxed);
+    for (size_t i = 0; i < occupancy.size(); ++i) {
+        occupancy[i].store(s.occupancy[i], std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < dwellNanos.size(); ++i) {
+        dwellNanos[i].store(s.dwellNanos[i], std::memory_order_relaxed);
+    }
+    dwellSampleShift = other.dwellSampleShift;
+    dwellEnabled = other.dwellEnabled;
+}
+
+inline void RingBufferStats::add(std::atomic<uint64_t>& counter, uint64_t n) noexcept {
+    // 单写者：普通的读+写即可，不需要 lock 前缀的读改写指令
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+inline void RingBufferStats::enableDwellSampling(unsigned sampleShift) {
+    dwellSampleShift = std::min(sampleShift, 30u);
+    dwellSamples = std::make_unique<DwellSample[]>(DWELL_SLOTS);
+    dwellEnabled = true;
+}
+
+inline void RingBufferStats::attach(size_t bufferCapacity) noexcept {
+    capacity.store(bufferCapacity, std::memory_order_relaxed);
+    occupancyScale = bufferCapacity == 0
+        ? 0
+        : (static_cast<uint64_t>(RingBufferStatsSnapshot::OCCUPANCY_BUCKETS) << 32) / bufferCapacity;
+}
+
+inline void RingBufferStats::recordOccupancy(size_t occupancyNow) noexcept {
+    const size_t bucket = std::min<size_t>(
+        static_cast<size_t>((occupancyNow * occupancyScale) >> 32),
+        RingBufferStatsSnapshot::OCCUPANCY_BUCKETS - 1);
+    add(occupancy[bucket], 1);
+    if (occupancyNow > highWaterMark.load(std::memory_order_relaxed)) {
+        highWaterMark.store(occupancyNow, std::memory_order_relaxed);
+    }
+}
+
+inline size_t RingBufferStats::nextSampled(size_t pos) const noexcept {
+    const size_t step = size_t{1} << dwellSampleShift;
+    return (pos + step - 1) & ~(step - 1);
+}
+
+inline void RingBufferStats::onPush(size_t firstPos, size_t count, size_t occupancyAfter) noexcept {
+    add(pushes, count);
+    recordOccupancy(occupancyAfter);
+
+    if (dwellEnabled) {
+        const size_t step = size_t{1} << dwellSampleShift;
+        const auto now = Clock::now();
+        for (size_t pos = nextSampled(firstPos); pos - firstPos < count; pos += step) {
+            DwellSample& sample = dwellSamples[(pos >> dwellSampleShift) % DWELL_SLOTS];
+            sample.position = pos;
+            sample.pushedAt = now;
+        }
+    }
+}
+
+inline void RingBufferStats::onPop(size_t firstPos, size_t count, size_t occupancyAfter) noexcept {
+    add(pops, count);
+    recordOccupancy(occupancyAfter);
+
+    if (dwellEnabled) {
+        const size_t step = size_t{1} << dwellSampleShift;
+        for (size_t pos = nextSampled(firstPos); pos - firstPos < count; pos += step) {
+            DwellSample& sample = dwellSamples[(pos >> dwellSampleShift) % DWELL_SLOTS];
+            if (sample.position != pos) {
+                continue;  // 采样槽已被更新的元素占用，或缓冲区被 clear 过
+            }
+            const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - sample.pushedAt).count();
+            const auto value = static_cast<uint64_t>(std::max<long long>(nanos, 1));
+            const size_t bucket = std::min<size_t>(
+                static_cast<size_t>(std::bit_width(value) - 1),
+                RingBufferStatsSnapshot::DWELL_BUCKETS - 1);
+            add(dwellNanos[bucket], 1);
+            sample.position = SIZE_MAX;
+        }
+    }
+}
+
+inline void RingBufferStats::onPushFailed(size_t count) noexcept {
+    add(failedPushes, count);
+}
+
+inline void RingBufferStats::onPopFailed() noexcept {
+    add(failedPops, 1);
+}
+
+inline void RingBufferStats::onDrop(size_t count) noexcept {
+    add(dropped, count);
+}
+
+inline RingBufferStatsSnapshot RingBufferStats::snapshot() const noexcept {
+    RingBufferStatsSnapshot s;
+    s.capacity = capacity.load(std::memory_order_relaxed);
+    s.pushes = pushes.load(std::memory_order_relaxed);
+    s.pops = pops.load(std::memory_order_relaxed);
+    s.failedPushes = failedPushes.load(std::memory_order_relaxed);
+    s.failedPops = failedPops.load(std::memory_order_relaxed);
+    s.dropped = dropped.load(std::memory_order_relaxed);
+    s.highWaterMark = highWaterMark.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < occupancy.size(); ++i) {
+        s.occupancy[i] = occupancy[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < dwellNanos.size(); ++i) {
+        s.dwellNanos[i] = dwellNanos[i].load(std::memory_order_relaxed);
+    }
+    return s;
+}
+
+inline void RingBufferStats::reset() noexcept {
+    pushes.store(0, std::memory_order_relaxed);
+    pops.store(0, std::memory_order_relaxed);
+    failedPushes.store(0, std::memory_order_relaxed);
+    failedPops.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    highWaterMark.store(0, std::memory_order_relaxed);
+    for (auto& bucket : occupancy) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    for (auto& bucket : dwellNanos) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+#endif // RINGBUFFERSTATS_CPP
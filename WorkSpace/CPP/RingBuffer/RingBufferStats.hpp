@@ -0,0 +1,108 @@
+#ifndef RINGBUFFERSTATS_HPP
+#define RINGBUFFERSTATS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// RingBuffer 的统计策略（作为第三个模板参数传入）
+//
+// 策略需要提供以下钩子，RingBuffer 在对应操作完成后调用：
+//   attach(capacity)                         构造时告知容量
+//   onPush(firstPos, count, occupancy)       成功写入 count 个元素，firstPos 为第一个元素的写计数
+//   onPop(firstPos, count, occupancy)        成功读出 count 个元素
+//   onPushFailed(count) / onPopFailed()      写入被拒绝的元素数 / 对空缓冲区的读取
+//   onDrop(count)                            覆盖模式下丢弃的元素数
+
+// 默认策略：全部为空函数，配合 [[no_unique_address]] 不占空间也不产生任何指令
+struct NoRingBufferStats {
+    void attach(size_t) noexcept {}
+    void onPush(size_t, size_t, size_t) noexcept {}
+    void onPop(size_t, size_t, size_t) noexcept {}
+    void onPushFailed(size_t) noexcept {}
+    void onPopFailed() noexcept {}
+    void onDrop(size_t) noexcept {}
+};
+
+// 某一时刻的统计快照，可定期导出
+struct RingBufferStatsSnapshot {
+    static constexpr size_t OCCUPANCY_BUCKETS = 8;   // 按容量八等分
+    static constexpr size_t DWELL_BUCKETS = 32;      // 第 i 桶：[2^i, 2^(i+1)) 纳秒
+
+    size_t capacity = 0;
+    uint64_t pushes = 0;
+    uint64_t pops = 0;
+    uint64_t failedPushes = 0;
+    uint64_t failedPops = 0;
+    uint64_t dropped = 0;
+    uint64_t highWaterMark = 0;
+    std::array<uint64_t, OCCUPANCY_BUCKETS> occupancy{};  // 每次写入/读出后的占用率分布
+    std::array<uint64_t, DWELL_BUCKETS> dwellNanos{};     // 采样元素的停留时间分布
+};
+
+// 启用的统计策略
+// 计数器只由操作缓冲区的线程写入（RingBuffer 本身单线程使用），
+// 因此使用 relaxed 的 load + store 而非原子读改写；其他线程可随时 snapshot。
+// 停留时间按写计数采样：每 2^dwellSampleShift 个元素记录一次时间戳。
+class RingBufferStats {
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t DWELL_SLOTS = 64;  // 同时在途的采样元素上限
+
+    struct DwellSample {
+        size_t position = SIZE_MAX;
+        Clock::time_point pushedAt;
+    };
+
+    std::atomic<size_t> capacity{0};
+    uint64_t occupancyScale = 0;  // (桶数 << 32) / capacity，避免每次做除法
+    std::atomic<uint64_t> pushes{0};
+    std::atomic<uint64_t> pops{0};
+    std::atomic<uint64_t> failedPushes{0};
+    std::atomic<uint64_t> failedPops{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> highWaterMark{0};
+    std::array<std::atomic<uint64_t>, RingBufferStatsSnapshot::OCCUPANCY_BUCKETS> occupancy{};
+    std::array<std::atomic<uint64_t>, RingBufferStatsSnapshot::DWELL_BUCKETS> dwellNanos{};
+
+    unsigned dwellSampleShift = 10;  // 默认每 1024 个元素采样一次
+    bool dwellEnabled = false;
+    std::unique_ptr<DwellSample[]> dwellSamples;
+
+    static void add(std::atomic<uint64_t>& counter, uint64_t n) noexcept;
+    void recordOccupancy(size_t occupancy) noexcept;
+    size_t nextSampled(size_t pos) const noexcept;  // >= pos 的第一个采样位置
+    void copyCounters(const RingBufferStats& other) noexcept;  // 计数器和采样设置，不含采样槽位
+    void copyFrom(const RingBufferStats& other);
+    void moveFrom(RingBufferStats& other) noexcept;
+
+public:
+    RingBufferStats();
+    RingBufferStats(const RingBufferStats& other);
+    RingBufferStats& operator=(const RingBufferStats& other);
+    // 移动只转移采样槽位的所有权，不分配内存：RingBuffer 的 noexcept 移动和 swap 依赖这一点
+    RingBufferStats(RingBufferStats&& other) noexcept;
+    RingBufferStats& operator=(RingBufferStats&& other) noexcept;
+
+    // 开启停留时间采样：每 2^sampleShift 个元素记录一次
+    void enableDwellSampling(unsigned sampleShift = 10);
+
+    // snapshot 可从任意线程调用；reset 只能由操作缓冲区的线程调用
+    RingBufferStatsSnapshot snapshot() const noexcept;
+    void reset() noexcept;
+
+    // 策略钩子
+    void attach(size_t bufferCapacity) noexcept;
+    void onPush(size_t firstPos, size_t count, size_t occupancyAfter) noexcept;
+    void onPop(size_t firstPos, size_t count, size_t occupancyAfter) noexcept;
+    void onPushFailed(size_t count) noexcept;
+    void onPopFailed() noexcept;
+    void onDrop(size_t count) noexcept;
+};
+
+#include "RingBufferStats.cpp"
+
+#endif // RINGBUFFERSTATS_HPP
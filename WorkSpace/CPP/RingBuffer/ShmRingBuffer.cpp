@@ -0,0 +1,430 @@
+#ifndef SHMRINGBUFFER_CPP
+#define SHMRINGBUFFER_CPP
+
+#include "ShmRingBuffer.hpp"
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template <typename T>
+ShmRingBuffer<T>::ShmRingBuffer(std::string segmentName, Role owner, void* mapping, size_t size)
+    : name(std::move(segmentName)), role(owner), base(mapping), mappedSize(size),
+      header(static_cast<Header*>(mapping)),
+      slots(reinterpret_cast<T*>(static_cast<char*>(mapping) + dataOffset())),
+      capacity(static_cast<size_t>(header->capacity)), mask(capacity - 1),
+      cachedHead(0), cachedTail(0), reserved(0) {
+    try {
+        validate();
+        claimRole();
+    } catch (...) {
+        unmap();
+        throw;
+    }
+    cachedHead = header->head.load(std::memory_order_acquire);
+    cachedTail = header->tail.load(std::memory_order_acquire);
+}
+
+// 槽位紧跟头部，按缓存行和 T 的对齐要求取较大者对齐
+template <typename T>
+size_t ShmRingBuffer<T>::dataOffset() noexcept {
+    const size_t align = std::max(CACHE_LINE_SIZE, alignof(T));
+    return (sizeof(Header) + align - 1) / align * align;
+}
+
+template <typename T>
+size_t ShmRingBuffer<T>::segmentSize(size_t cap) noexcept {
+    return dataOffset() + cap * sizeof(T);
+}
+
+template <typename T>
+ShmRingBuffer<T> ShmRingBuffer<T>::create(const std::string& name, size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("ShmRingBuffer capacity must be greater than 0");
+    }
+    capacity = std::bit_ceil(capacity);
+    const size_t size = segmentSize(capacity);
+
+    // 段已存在但创建者始终没有完成初始化（在 shm_open 与发布 magic 之间崩溃）时，
+    // 视为遗弃的段：删除名字后重新创建一次
+    for (bool recovered = false;; recovered = true) {
+        // O_EXCL 保证只有一个进程负责初始化头部
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd >= 0) {
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                const int error = errno;
+                close(fd);
+                shm_unlink(name.c_str());
+                throw std::system_error(error, std::generic_category(), "ShmRingBuffer ftruncate");
+            }
+            void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            const int error = errno;
+            close(fd);  // 映射会保持段存活
+            if (mapping == MAP_FAILED) {
+                shm_unlink(name.c_str());
+                throw std::system_error(error, std::generic_category(), "ShmRingBuffer mmap");
+            }
+
+            // ftruncate 得到的是全零页，只需填写非零字段，magic 最后发布
+            Header* h = new (mapping) Header();
+            h->version = VERSION;
+            h->capacity = capacity;
+            h->elementSize = sizeof(T);
+            h->elementAlign = alignof(T);
+            h->magic.store(MAGIC, std::memory_order_release);
+            return ShmRingBuffer(name, Role::Producer, mapping, size);
+        }
+        if (errno != EEXIST) {
+            throw std::system_error(errno, std::generic_category(), "ShmRingBuffer shm_open");
+        }
+
+        // 段已存在（例如生产者崩溃后重启）：校验后接管
+        fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            if (errno == ENOENT && !recovered) {
+                continue;  // 名字刚被删除，重新创建
+            }
+            throw std::system_error(errno, std::generic_category(), "ShmRingBuffer shm_open");
+        }
+        size_t mapped = 0;
+        void* mapping = mapExisting(fd, mapped);
+        if (!mapping) {
+            if (recovered) {
+                throw std::runtime_error("ShmRingBuffer segment was never initialized");
+            }
+            shm_unlink(name.c_str());  // 已映射旧段的进程不受影响
+            continue;
+        }
+        ShmRingBuffer rb(name, Role::Producer, mapping, mapped);
+        if (rb.capacity != capacity) {
+            throw std::invalid_argument("ShmRingBuffer segment exists with a different capacity");
+        }
+        return rb;
+    }
+}
+
+template <typename T>
+ShmRingBuffer<T> ShmRingBuffer<T>::attach(const std::string& name) {
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "ShmRingBuffer shm_open");
+    }
+    size_t mapped = 0;
+    void* mapping = mapExisting(fd, mapped);
+    if (!mapping) {
+        throw std::runtime_error("ShmRingBuffer segment was never initialized");
+    }
+    return ShmRingBuffer(name, Role::Consumer, mapping, mapped);
+}
+
+template <typename T>
+bool ShmRingBuffer<T>::remove(const std::string& name) noexcept {
+    return shm_unlink(name.c_str()) == 0;
+}
+
+// 创建者可能还没完成 ftruncate 或头部初始化：最多等待约 1 秒，超时返回 nullptr
+// 无论成功与否都会关闭 fd
+template <typename T>
+void* ShmRingBuffer<T>::mapExisting(int fd, size_t& size) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    for (;;) {
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            const int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "ShmRingBuffer fstat");
+        }
+        size = static_cast<size_t>(st.st_size);
+        if (size >= dataOffset()) {
+            void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                const int error = errno;
+                close(fd);
+                throw std::system_error(error, std::generic_category(), "ShmRingBuffer mmap");
+            }
+            if (static_cast<Header*>(mapping)->magic.load(std::memory_order_acquire) != 0) {
+                close(fd);
+                return mapping;
+            }
+            munmap(mapping, size);
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            close(fd);
+            return nullptr;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+template <typename T>
+void ShmRingBuffer<T>::validate() const {
+    if (header->magic.load(std::memory_order_acquire) != MAGIC) {
+        throw std::runtime_error("ShmRingBuffer segment has an unknown format");
+    }
+    if (header->version != VERSION) {
+        throw std::runtime_error("ShmRingBuffer segment version mismatch");
+    }
+    if (header->elementSize != sizeof(T) || header->elementAlign != alignof(T)) {
+        throw std::runtime_error("ShmRingBuffer segment element type mismatch");
+    }
+    if (capacity == 0 || !std::has_single_bit(capacity) || mappedSize < segmentSize(capacity)) {
+        throw std::runtime_error("ShmRingBuffer segment is truncated or corrupted");
+    }
+}
+
+// kill(pid, 0) 只检查进程是否存在，不发送信号
+template <typename T>
+bool ShmRingBuffer<T>::isAlive(int32_t pid) noexcept {
+    return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+template <typename T>
+void ShmRingBuffer<T>::claimRole() {
+    std::atomic<int32_t>& owner = role == Role::Producer ? header->producerPid : header->consumerPid;
+    const auto self = static_cast<int32_t>(getpid());
+    int32_t current = owner.load(std::memory_order_acquire);
+    for (;;) {
+        if (current != 0 && isAlive(current)) {
+            throw std::runtime_error(role == Role::Producer
+                                         ? "ShmRingBuffer already has a live producer"
+                                         : "ShmRingBuffer already has a live consumer");
+        }
+        // 原持有者已退出：它未发布的写入/未确认的读取都不会影响计数，直接接管
+        if (owner.compare_exchange_weak(current, self, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+}
+
+template <typename T>
+void ShmRingBuffer<T>::releaseRole() noexcept {
+    std::atomic<int32_t>& owner = role == Role::Producer ? header->producerPid : header->consumerPid;
+    // fork 出的子进程析构继承来的对象时不会注销父进程的角色
+    int32_t self = static_cast<int32_t>(getpid());
+    owner.compare_exchange_strong(self, 0, std::memory_order_acq_rel);
+}
+
+template <typename T>
+void ShmRingBuffer<T>::unmap() noexcept {
+    if (base) {
+        munmap(base, mappedSize);
+        base = nullptr;
+        header = nullptr;
+        slots = nullptr;
+    }
+}
+
+template <typename T>
+ShmRingBuffer<T>::~ShmRingBuffer() {
+    if (header) {
+        releaseRole();
+    }
+    unmap();
+}
+
+template <typename T>
+ShmRingBuffer<T>::ShmRingBuffer(ShmRingBuffer&& other) noexcept
+    : name(std::move(other.name)), role(other.role), base(std::exchange(other.base, nullptr)),
+      mappedSize(std::exchange(other.mappedSize, 0)), header(std::exchange(other.header, nullptr)),
+      slots(std::exchange(other.slots, nullptr)), capacity(std::exchange(other.capacity, 0)),
+      mask(std::exchange(other.mask, 0)), cachedHead(other.cachedHead),
+      cachedTail(other.cachedTail), reserved(std::exchange(other.reserved, 0)) {}
+
+template <typename T>
+ShmRingBuffer<T>& ShmRingBuffer<T>::operator=(ShmRingBuffer&& other) noexcept {
+    if (this != &other) {
+        if (header) {
+            releaseRole();
+        }
+        unmap();
+        name = std::move(other.name);
+        role = other.role;
+        base = std::exchange(other.base, nullptr);
+        mappedSize = std::exchange(other.mappedSize, 0);
+        header = std::exchange(other.header, nullptr);
+        slots = std::exchange(other.slots, nullptr);
+        capacity = std::exchange(other.capacity, 0);
+        mask = std::exchange(other.mask, 0);
+        cachedHead = other.cachedHead;
+        cachedTail = other.cachedTail;
+        reserved = std::exchange(other.reserved, 0);
+    }
+    return *this;
+}
+
+template <typename T>
+void ShmRingBuffer<T>::requireRole(Role expected, const char* operation) const {
+    if (role != expected) {
+        throw std::logic_error(std::string("ShmRingBuffer::") + operation +
+                               (expected == Role::Producer ? " requires the producer side"
+                                                           : " requires the consumer side"));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 生产者操作：只写 tail，读 head 时优先使用本地缓存
+// ---------------------------------------------------------------------------
+template <typename T>
+bool ShmRingBuffer<T>::push(const T& item) {
+    return pushMultiple(&item, 1) == 1;
+}
+
+template <typename T>
+size_t ShmRingBuffer<T>::pushMultiple(const T* items, size_t num) {
+    requireRole(Role::Producer, "pushMultiple");
+    const uint64_t t = header->tail.load(std::memory_order_relaxed);
+    size_t space = capacity - static_cast<size_t>(t - cachedHead);
+    if (space < num) {
+        cachedHead = header->head.load(std::memory_order_acquire);
+        space = capacity - static_cast<size_t>(t - cachedHead);
+    }
+
+    const size_t n = std::min(num, space);
+    const size_t start = static_cast<size_t>(t) & mask;
+    const size_t first = std::min(n, capacity - start);
+    std::memcpy(slots + start, items, first * sizeof(T));
+    std::memcpy(slots, items + first, (n - first) * sizeof(T));
+
+    // 数据写完才发布：在此之前崩溃，消费者看不到这些槽位
+    header->tail.store(t + n, std::memory_order_release);
+    return n;
+}
+
+template <typename T>
+typename ShmRingBuffer<T>::template SpanPair<T> ShmRingBuffer<T>::reserve(size_t num) {
+    requireRole(Role::Producer, "reserve");
+    const uint64_t t = header->tail.load(std::memory_order_relaxed);
+    cachedHead = header->head.load(std::memory_order_acquire);
+    const size_t n = std::min(num, capacity - static_cast<size_t>(t - cachedHead));
+    reserved = n;
+
+    const size_t start = static_cast<size_t>(t) & mask;
+    const size_t first = std::min(n, capacity - start);
+    return {std::span<T>(slots + start, first), std::span<T>(slots, n - first)};
+}
+
+template <typename T>
+void ShmRingBuffer<T>::commit(size_t num) {
+    requireRole(Role::Producer, "commit");
+    if (num > reserved) {
+        throw std::out_of_range("ShmRingBuffer commit exceeds reserved slots");
+    }
+    reserved = 0;
+    // 只有生产者写 tail：普通的读+写即可
+    const uint64_t t = header->tail.load(std::memory_order_relaxed);
+    header->tail.store(t + num, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// 消费者操作：只写 head，读 tail 时优先使用本地缓存
+// ---------------------------------------------------------------------------
+template <typename T>
+bool ShmRingBuffer<T>::pop(T& item) {
+    return popMultiple(&item, 1) == 1;
+}
+
+template <typename T>
+std::optional<T> ShmRingBuffer<T>::pop() {
+    T item;
+    if (popMultiple(&item, 1) == 0) {
+        return std::nullopt;
+    }
+    return item;
+}
+
+template <typename T>
+size_t ShmRingBuffer<T>::popMultiple(T* items, size_t num) {
+    const auto segments = readable();
+    const size_t n = std::min(num, segments.size());
+    const size_t first = std::min(n, segments.first.size());
+    std::memcpy(items, segments.first.data(), first * sizeof(T));
+    std::memcpy(items + first, segments.second.data(), (n - first) * sizeof(T));
+    consume(n);
+    return n;
+}
+
+template <typename T>
+typename ShmRingBuffer<T>::template SpanPair<const T> ShmRingBuffer<T>::readable() {
+    requireRole(Role::Consumer, "readable");
+    const uint64_t h = header->head.load(std::memory_order_relaxed);
+    cachedTail = header->tail.load(std::memory_order_acquire);
+    const size_t n = static_cast<size_t>(cachedTail - h);
+
+    const size_t start = static_cast<size_t>(h) & mask;
+    const size_t first = std::min(n, capacity - start);
+    return {std::span<const T>(slots + start, first), std::span<const T>(slots, n - first)};
+}
+
+template <typename T>
+void ShmRingBuffer<T>::consume(size_t num) {
+    requireRole(Role::Consumer, "consume");
+    const uint64_t h = header->head.load(std::memory_order_relaxed);
+    if (num > static_cast<size_t>(cachedTail - h)) {
+        throw std::out_of_range("ShmRingBuffer consume exceeds readable elements");
+    }
+    if (num > 0) {
+        header->head.store(h + num, std::memory_order_release);
+    }
+}
+
+template <typename T>
+template <typename F>
+size_t ShmRingBuffer<T>::consume_all(F&& f) {
+    const auto segments = readable();
+    for (const T& item : segments.first) {
+        f(item);
+    }
+    for (const T& item : segments.second) {
+        f(item);
+    }
+    consume(segments.size());  // 整批只发布一次 head
+    return segments.size();
+}
+
+// ---------------------------------------------------------------------------
+// 状态查询
+// ---------------------------------------------------------------------------
+template <typename T>
+bool ShmRingBuffer<T>::isPeerAlive() const noexcept {
+    const std::atomic<int32_t>& peer = role == Role::Producer ? header->consumerPid : header->producerPid;
+    return isAlive(peer.load(std::memory_order_acquire));
+}
+
+template <typename T>
+bool ShmRingBuffer<T>::isEmpty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+size_t ShmRingBuffer<T>::size() const noexcept {
+    const uint64_t h = header->head.load(std::memory_order_acquire);
+    const uint64_t t = header->tail.load(std::memory_order_acquire);
+    return static_cast<size_t>(t - h);
+}
+
+template <typename T>
+size_t ShmRingBuffer<T>::getCapacity() const noexcept {
+    return capacity;
+}
+
+template <typename T>
+const std::string& ShmRingBuffer<T>::getName() const noexcept {
+    return name;
+}
+
+#endif // __linux__
+
+#endif // SHMRINGBUFFER_CPP
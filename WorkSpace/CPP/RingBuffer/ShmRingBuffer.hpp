@@ -0,0 +1,140 @@
+#ifndef SHMRINGBUFFER_HPP
+#define SHMRINGBUFFER_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#if defined(__linux__)
+
+// 位于具名 POSIX 共享内存（shm_open + mmap）中的 SPSC 环形缓冲区，用于进程间传递数据
+// 依赖 POSIX 共享内存和进程 API，仅在 Linux 上提供（与 ByteRingBuffer 的双重映射相同）
+// 生产者进程 create 创建（或接管）段，消费者进程 attach 附加；双方直接读写同一块物理内存，
+// 数据不经过内核拷贝，也不需要序列化。
+//
+// 段布局：版本化头部（magic、版本、容量、元素大小、读写计数）+ 按缓存行对齐的槽位数组。
+// 崩溃恢复：
+//   - 元素先写入槽位，再以 release 发布 tail；生产者在写入中途崩溃时，未发布的槽位对消费者不可见
+//   - 头部记录双方进程号；原进程已退出时，新进程可以接管对应角色，已发布的数据保持不变
+//   - 消费者只在处理完后推进 head，崩溃时正在处理的元素会重新交给下一个消费者（至少一次）
+//   - 创建者在 shm_open 之后、发布 magic 之前崩溃时，段的头部始终为 0：create 等待约 1 秒后
+//     删除这个遗弃的名字并重新创建；attach 则抛出异常，需在生产者重建后重新附加
+// 注意：进程号可能被复用，进程退出但未被 wait 回收（僵尸进程）时仍视为存活。
+template <typename T>
+class ShmRingBuffer {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "ShmRingBuffer elements are shared between processes and must be trivially copyable");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "ShmRingBuffer requires address-free lock-free 64-bit atomics");
+
+public:
+    static constexpr uint32_t MAGIC = 0x53524246;  // "SRBF"
+    static constexpr uint32_t VERSION = 1;
+
+    // 环形区间最多由两段连续内存组成（与 RingBuffer::SpanPair 相同）
+    template <typename U>
+    struct SpanPair {
+        std::span<U> first;
+        std::span<U> second;
+
+        size_t size() const noexcept { return first.size() + second.size(); }
+        bool empty() const noexcept { return size() == 0; }
+    };
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // 共享内存中的头部：只包含定长字段，两个进程按同一布局解释
+    struct Header {
+        std::atomic<uint32_t> magic;  // 最后写入，非 0 表示头部已初始化完毕
+        uint32_t version;
+        uint64_t capacity;
+        uint64_t elementSize;
+        uint64_t elementAlign;
+        std::atomic<int32_t> producerPid;  // 0 表示当前没有生产者
+        std::atomic<int32_t> consumerPid;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;  // 已发布的写计数（只由生产者写）
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;  // 已消费的读计数（只由消费者写）
+    };
+
+    enum class Role { Producer, Consumer };
+
+    std::string name;
+    Role role;
+    void* base;         // 映射起点（即 Header）
+    size_t mappedSize;
+    Header* header;
+    T* slots;
+    size_t capacity;
+    size_t mask;
+    uint64_t cachedHead;  // 生产者对 head 的本地缓存
+    uint64_t cachedTail;  // 消费者对 tail 的本地缓存
+    size_t reserved;      // reserve 后尚未 commit 的槽位数
+
+    ShmRingBuffer(std::string segmentName, Role owner, void* mapping, size_t size);
+
+    static size_t dataOffset() noexcept;
+    static size_t segmentSize(size_t capacity) noexcept;
+    static void* mapExisting(int fd, size_t& size);  // 等待创建者完成初始化后映射整个段，超时返回 nullptr
+    static bool isAlive(int32_t pid) noexcept;
+    void validate() const;
+    void claimRole();   // 登记本进程为生产者/消费者，原持有者仍存活时抛出异常
+    void releaseRole() noexcept;
+    void unmap() noexcept;
+    void requireRole(Role expected, const char* operation) const;
+
+public:
+    // 生产者：创建名为 name 的段；段已存在时校验布局并接管（原生产者必须已退出），
+    // 未初始化的遗弃段会被删除后重建（同一时刻只能有一个进程以生产者身份调用）
+    static ShmRingBuffer create(const std::string& name, size_t capacity);
+    // 消费者：按名字附加到已有的段
+    static ShmRingBuffer attach(const std::string& name);
+    // 删除段的名字（已映射的进程不受影响），名字不存在时返回 false
+    static bool remove(const std::string& name) noexcept;
+
+    // 析构只解除映射并注销角色，不删除段
+    ~ShmRingBuffer();
+
+    ShmRingBuffer(const ShmRingBuffer&) = delete;
+    ShmRingBuffer& operator=(const ShmRingBuffer&) = delete;
+    ShmRingBuffer(ShmRingBuffer&& other) noexcept;
+    ShmRingBuffer& operator=(ShmRingBuffer&& other) noexcept;
+
+    // 生产者操作
+    bool push(const T& item);
+    size_t pushMultiple(const T* items, size_t num);
+    // 零拷贝写入：直接在共享内存槽位中填写，commit 后才对消费者可见
+    SpanPair<T> reserve(size_t num);
+    void commit(size_t num);
+
+    // 消费者操作
+    bool pop(T& item);
+    std::optional<T> pop();
+    size_t popMultiple(T* items, size_t num);
+    // 零拷贝读取：原地访问共享内存中的元素，处理完后 consume 释放
+    SpanPair<const T> readable();
+    void consume(size_t num);
+    template <typename F>
+    size_t consume_all(F&& f);
+
+    // 对端进程（生产者看消费者，消费者看生产者）是否仍然存活
+    bool isPeerAlive() const noexcept;
+
+    // 状态查询（并发时为近似值）
+    bool isEmpty() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+    const std::string& getName() const noexcept;
+};
+
+#include "ShmRingBuffer.cpp"
+
+#endif // __linux__
+
+#endif // SHMRINGBUFFER_HPP
@@ -0,0 +1,379 @@
+#ifndef SPSCRINGBUFFER_CPP
+#define SPSCRINGBUFFER_CPP
+
+#include "SpscRingBuffer.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+template <typename T>
+SpscRingBuffer<T>::SpscRingBuffer(size_t size)
+    : capacity(size), slots(size + 1),
+      tail(0), cachedHead(0), head(0), cachedTail(0), closed(false) {
+    if (size == 0) {
+        throw std::invalid_argument("SpscRingBuffer size must be greater than 0");
+    }
+    buffer = std::make_unique<T[]>(slots);
+}
+
+// 下标前进一格：用比较代替取模，避免整数除法
+template <typename T>
+size_t SpscRingBuffer<T>::next(size_t index) const noexcept {
+    ++index;
+    return index == slots ? 0 : index;
+}
+
+// 从 from 到 to 之间的元素个数
+template <typename T>
+size_t SpscRingBuffer<T>::distance(size_t from, size_t to) const noexcept {
+    return to >= from ? to - from : to + slots - from;
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::hasSpace() const noexcept {
+    return next(tail.load(std::memory_order_relaxed)) != head.load(std::memory_order_acquire);
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::hasData() const noexcept {
+    return head.load(std::memory_order_relaxed) != tail.load(std::memory_order_acquire);
+}
+
+// ---------------------------------------------------------------------------
+// 生产者操作：只写 tail，读 head 时优先使用本地缓存
+// ---------------------------------------------------------------------------
+template <typename T>
+bool SpscRingBuffer<T>::push(const T& item) {
+    const size_t t = tail.load(std::memory_order_relaxed);
+    const size_t nextTail = next(t);
+    if (nextTail == cachedHead) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (nextTail == cachedHead) {
+            return false;
+        }
+    }
+
+    buffer[t] = item;
+    tail.store(nextTail, std::memory_order_release);
+    notEmpty.notify();
+    return true;
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::push(T&& item) {
+    const size_t t = tail.load(std::memory_order_relaxed);
+    const size_t nextTail = next(t);
+    if (nextTail == cachedHead) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (nextTail == cachedHead) {
+            return false;
+        }
+    }
+
+    buffer[t] = std::move(item);
+    tail.store(nextTail, std::memory_order_release);
+    notEmpty.notify();
+    return true;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::pushMultiple(const T* items, size_t num) {
+    const size_t t = tail.load(std::memory_order_relaxed);
+    size_t space = capacity - distance(cachedHead, t);
+    if (space < num) {
+        cachedHead = head.load(std::memory_order_acquire);
+        space = capacity - distance(cachedHead, t);
+    }
+
+    const size_t n = std::min(num, space);
+    const size_t first = std::min(n, slots - t);
+    std::copy(items, items + first, buffer.get() + t);
+    std::copy(items + first, items + n, buffer.get());
+
+    // 整批只发布一次 tail
+    const size_t nextTail = t + n < slots ? t + n : t + n - slots;
+    tail.store(nextTail, std::memory_order_release);
+    notEmpty.notify();
+    return n;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::pushMultiple(const std::vector<T>& items) {
+    return pushMultiple(items.data(), items.size());
+}
+
+// ---------------------------------------------------------------------------
+// 消费者操作：只写 head，读 tail 时优先使用本地缓存
+// ---------------------------------------------------------------------------
+template <typename T>
+bool SpscRingBuffer<T>::pop(T& item) {
+    const size_t h = head.load(std::memory_order_relaxed);
+    if (h == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (h == cachedTail) {
+            return false;
+        }
+    }
+
+    item = std::move(buffer[h]);
+    head.store(next(h), std::memory_order_release);
+    notFull.notify();
+    return true;
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::peek(T& item) const {
+    const size_t h = head.load(std::memory_order_relaxed);
+    if (h == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (h == cachedTail) {
+            return false;
+        }
+    }
+
+    item = buffer[h];
+    return true;
+}
+
+template <typename T>
+std::optional<T> SpscRingBuffer<T>::pop() {
+    const size_t h = head.load(std::memory_order_relaxed);
+    if (h == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (h == cachedTail) {
+            return std::nullopt;
+        }
+    }
+
+    T item = std::move(buffer[h]);
+    head.store(next(h), std::memory_order_release);
+    notFull.notify();
+    return item;
+}
+
+template <typename T>
+std::optional<T> SpscRingBuffer<T>::peek() const {
+    const size_t h = head.load(std::memory_order_relaxed);
+    if (h == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (h == cachedTail) {
+            return std::nullopt;
+        }
+    }
+
+    return buffer[h];
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::popMultiple(T* items, size_t num) {
+    const size_t h = head.load(std::memory_order_relaxed);
+    size_t available = distance(h, cachedTail);
+    if (available < num) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        available = distance(h, cachedTail);
+    }
+
+    const size_t n = std::min(num, available);
+    const size_t first = std::min(n, slots - h);
+    std::move(buffer.get() + h, buffer.get() + h + first, items);
+    std::move(buffer.get(), buffer.get() + (n - first), items + first);
+
+    // 整批只发布一次 head
+    publishHead(h, n);
+    return n;
+}
+
+template <typename T>
+void SpscRingBuffer<T>::publishHead(size_t h, size_t n) noexcept {
+    const size_t nextHead = h + n < slots ? h + n : h + n - slots;
+    head.store(nextHead, std::memory_order_release);
+    notFull.notify();
+}
+
+template <typename T>
+template <typename F>
+size_t SpscRingBuffer<T>::consume_all(F&& f) {
+    return consume_up_to(SIZE_MAX, std::forward<F>(f));
+}
+
+template <typename T>
+template <typename F>
+size_t SpscRingBuffer<T>::consume_up_to(size_t num, F&& f) {
+    const size_t h = head.load(std::memory_order_relaxed);
+    size_t available = distance(h, cachedTail);
+    if (available < num) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        available = distance(h, cachedTail);
+    }
+
+    const size_t n = std::min(num, available);
+    const size_t first = std::min(n, slots - h);
+    size_t done = 0;
+    try {
+        for (; done < first; ++done) {
+            f(buffer[h + done]);
+        }
+        for (; done < n; ++done) {
+            f(buffer[done - first]);
+        }
+    } catch (...) {
+        if (done > 0) {
+            publishHead(h, done);
+        }
+        throw;
+    }
+    if (n > 0) {
+        publishHead(h, n);
+    }
+    return n;
+}
+
+template <typename T>
+std::vector<T> SpscRingBuffer<T>::popMultiple(size_t num) {
+    const size_t h = head.load(std::memory_order_relaxed);
+    cachedTail = tail.load(std::memory_order_acquire);
+    const size_t n = std::min(num, distance(h, cachedTail));
+
+    std::vector<T> result;
+    result.reserve(n);
+    size_t index = h;
+    for (size_t i = 0; i < n; ++i) {
+        result.push_back(std::move(buffer[index]));
+        index = next(index);
+    }
+
+    head.store(index, std::memory_order_release);
+    notFull.notify();
+    return result;
+}
+
+template <typename T>
+void SpscRingBuffer<T>::clear() noexcept {
+    cachedTail = tail.load(std::memory_order_acquire);
+    head.store(cachedTail, std::memory_order_release);
+    notFull.notify();
+}
+
+// ---------------------------------------------------------------------------
+// 阻塞操作
+// ---------------------------------------------------------------------------
+template <typename T>
+bool SpscRingBuffer<T>::push_wait(const T& item) {
+    for (;;) {
+        if (closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (push(item)) {
+            return true;
+        }
+        notFull.waitUntil([this] {
+            return hasSpace() || closed.load(std::memory_order_acquire);
+        });
+    }
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::push_wait(T&& item) {
+    for (;;) {
+        if (closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (push(std::move(item))) {  // 失败时 item 不会被移走
+            return true;
+        }
+        notFull.waitUntil([this] {
+            return hasSpace() || closed.load(std::memory_order_acquire);
+        });
+    }
+}
+
+// 等到有数据或队列关闭；超时返回 false
+template <typename T>
+bool SpscRingBuffer<T>::waitForData(const std::chrono::steady_clock::time_point* deadline) {
+    return notEmpty.waitUntil([this] {
+        return hasData() || closed.load(std::memory_order_acquire);
+    }, deadline);
+}
+
+template <typename T>
+std::optional<T> SpscRingBuffer<T>::pop_wait() {
+    for (;;) {
+        if (auto item = pop()) {
+            return item;
+        }
+        if (closed.load(std::memory_order_acquire)) {
+            return pop();  // 关闭前最后发布的元素此时一定可见
+        }
+        waitForData(nullptr);
+    }
+}
+
+template <typename T>
+template <typename Rep, typename Period>
+std::optional<T> SpscRingBuffer<T>::pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+    for (;;) {
+        if (auto item = pop()) {
+            return item;
+        }
+        if (closed.load(std::memory_order_acquire) || !waitForData(&deadline)) {
+            return pop();
+        }
+    }
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::pop_wait_multiple(T* items, size_t num) {
+    if (num == 0) {
+        return 0;
+    }
+    for (;;) {
+        if (size_t n = popMultiple(items, num)) {
+            return n;
+        }
+        if (closed.load(std::memory_order_acquire)) {
+            return popMultiple(items, num);
+        }
+        waitForData(nullptr);
+    }
+}
+
+template <typename T>
+void SpscRingBuffer<T>::close() noexcept {
+    closed.store(true, std::memory_order_release);
+    notEmpty.notifyAll();
+    notFull.notifyAll();
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::isClosed() const noexcept {
+    return closed.load(std::memory_order_acquire);
+}
+
+// ---------------------------------------------------------------------------
+// 状态查询：另一侧可能同时在修改，结果只是某一时刻的快照
+// ---------------------------------------------------------------------------
+template <typename T>
+bool SpscRingBuffer<T>::isEmpty() const noexcept {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::isFull() const noexcept {
+    return size() == capacity;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::size() const noexcept {
+    const size_t h = head.load(std::memory_order_acquire);
+    const size_t t = tail.load(std::memory_order_acquire);
+    return distance(h, t);
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::getCapacity() const noexcept {
+    return capacity;
+}
+
+#endif // SPSCRINGBUFFER_CPP
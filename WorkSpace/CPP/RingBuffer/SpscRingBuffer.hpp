@@ -0,0 +1,102 @@
+#ifndef SPSCRINGBUFFER_HPP
+#define SPSCRINGBUFFER_HPP
+
+#include "WaitSignal.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// 单生产者/单消费者（SPSC）无锁环形缓冲区
+// 接口与 RingBuffer<T> 保持一致，生产者线程只调用 push 系列，
+// 消费者线程只调用 pop/peek 系列，双方仅通过 acquire/release 原子操作同步。
+template <typename T>
+class SpscRingBuffer {
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // 只读共享数据：构造后不再修改
+    std::unique_ptr<T[]> buffer;
+    size_t capacity;
+    size_t slots;  // capacity + 1，空出一个槽位区分满和空
+
+    // 生产者独占的缓存行：tail 以及对 head 的本地缓存
+    // （alignas 同时保证整个对象按缓存行对齐，末尾不会与相邻对象伪共享）
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail;
+    size_t cachedHead;
+
+    // 消费者独占的缓存行：head 以及对 tail 的本地缓存
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head;
+    mutable size_t cachedTail;  // peek 为 const 操作，也可能刷新该缓存
+
+    // 阻塞接口使用的等待信号：只有线程真正休眠时才会被写入
+    alignas(CACHE_LINE_SIZE) WaitSignal notEmpty;  // 消费者等待，生产者通知
+    WaitSignal notFull;                            // 生产者等待，消费者通知
+    std::atomic<bool> closed;
+
+    size_t next(size_t index) const noexcept;
+    size_t distance(size_t from, size_t to) const noexcept;
+    bool hasSpace() const noexcept;    // 生产者视角：是否还有空槽位
+    bool hasData() const noexcept;     // 消费者视角：是否有可读元素
+    bool waitForData(const std::chrono::steady_clock::time_point* deadline);
+    void publishHead(size_t h, size_t n) noexcept;  // 消费者：head 前进 n 格并唤醒生产者
+
+public:
+    // 构造函数
+    explicit SpscRingBuffer(size_t size);
+
+    ~SpscRingBuffer() = default;
+
+    // 原子变量不可拷贝也不可移动
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+    SpscRingBuffer(SpscRingBuffer&&) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+    // 生产者操作
+    bool push(const T& item);
+    bool push(T&& item);
+    size_t pushMultiple(const T* items, size_t num);
+    size_t pushMultiple(const std::vector<T>& items);
+
+    // 消费者操作
+    bool pop(T& item);
+    bool peek(T& item) const;
+    std::optional<T> pop();
+    std::optional<T> peek() const;
+    size_t popMultiple(T* items, size_t num);
+    std::vector<T> popMultiple(size_t num);
+    void clear() noexcept;  // 仅消费者调用：丢弃当前所有元素
+
+    // 批量消费：原地对每个可读元素调用 f(T&)，整批结束后只发布一次 head；
+    // f 抛出异常时，之前已处理的元素视为已取出
+    template <typename F>
+    size_t consume_all(F&& f);
+    template <typename F>
+    size_t consume_up_to(size_t num, F&& f);
+
+    // 阻塞操作：先短暂自旋，再休眠等待对方唤醒
+    bool push_wait(const T& item);   // 关闭后返回 false
+    bool push_wait(T&& item);
+    std::optional<T> pop_wait();     // 关闭且取空后返回 nullopt
+    template <typename Rep, typename Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout);
+    size_t pop_wait_multiple(T* items, size_t num);  // 至少取到 1 个；关闭且取空后返回 0
+
+    // 关闭队列：唤醒所有等待者，消费者取完剩余元素后即可退出
+    void close() noexcept;
+    bool isClosed() const noexcept;
+
+    // 状态查询（并发时为近似值）
+    bool isEmpty() const noexcept;
+    bool isFull() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+};
+
+#include "SpscRingBuffer.cpp"
+
+#endif // SPSCRINGBUFFER_HPP
@@ -0,0 +1,164 @@
+#ifndef STATICRINGBUFFER_CPP
+#define STATICRINGBUFFER_CPP
+
+#include "StaticRingBuffer.hpp"
+#include <algorithm>
+#include <utility>
+
+template <typename T, size_t N>
+StaticRingBuffer<T, N>::StaticRingBuffer() noexcept
+    : buffer{}, head(0), tail(0) {}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::push(const T& item) {
+    if (isFull()) {
+        return false;
+    }
+    
+    buffer[tail & MASK] = item;
+    ++tail;
+    return true;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::push(T&& item) {
+    if (isFull()) {
+        return false;
+    }
+    
+    buffer[tail & MASK] = std::move(item);
+    ++tail;
+    return true;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::pop(T& item) {
+    if (isEmpty()) {
+        return false;
+    }
+    
+    item = std::move(buffer[head & MASK]);
+    ++head;
+    return true;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::peek(T& item) const {
+    if (isEmpty()) {
+        return false;
+    }
+    
+    item = buffer[head & MASK];
+    return true;
+}
+
+template <typename T, size_t N>
+std::optional<T> StaticRingBuffer<T, N>::pop() {
+    if (isEmpty()) {
+        return std::nullopt;
+    }
+    
+    T item = std::move(buffer[head & MASK]);
+    ++head;
+    return item;
+}
+
+template <typename T, size_t N>
+std::optional<T> StaticRingBuffer<T, N>::peek() const {
+    if (isEmpty()) {
+        return std::nullopt;
+    }
+    
+    return buffer[head & MASK];
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::isEmpty() const noexcept {
+    return tail == head;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::isFull() const noexcept {
+    return tail - head == N;
+}
+
+template <typename T, size_t N>
+size_t StaticRingBuffer<T, N>::size() const noexcept {
+    return tail - head;
+}
+
+template <typename T, size_t N>
+void StaticRingBuffer<T, N>::clear() noexcept {
+    head = 0;
+    tail = 0;
+}
+
+template <typename T, size_t N>
+size_t StaticRingBuffer<T, N>::pushMultiple(const T* items, size_t num) {
+    const size_t n = std::min(num, N - size());
+    for (size_t i = 0; i < n; ++i) {
+        buffer[(tail + i) & MASK] = items[i];
+    }
+    tail += n;
+    return n;
+}
+
+template <typename T, size_t N>
+size_t StaticRingBuffer<T, N>::pushMultiple(const std::vector<T>& items) {
+    return pushMultiple(items.data(), items.size());
+}
+
+template <typename T, size_t N>
+size_t StaticRingBuffer<T, N>::popMultiple(T* items, size_t num) {
+    const size_t n = std::min(num, size());
+    for (size_t i = 0; i < n; ++i) {
+        items[i] = std::move(buffer[(head + i) & MASK]);
+    }
+    head += n;
+    return n;
+}
+
+template <typename T, size_t N>
+std::vector<T> StaticRingBuffer<T, N>::popMultiple(size_t num) {
+    const size_t n = std::min(num, size());
+    std::vector<T> result;
+    result.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        result.push_back(std::move(buffer[(head + i) & MASK]));
+    }
+    head += n;
+    return result;
+}
+
+// 迭代器实现
+template <typename T, size_t N>
+StaticRingBuffer<T, N>::Iterator::Iterator(const StaticRingBuffer* buffer, size_t pos)
+    : rb(buffer), position(pos) {}
+
+template <typename T, size_t N>
+const T& StaticRingBuffer<T, N>::Iterator::operator*() const {
+    return rb->buffer[position & MASK];
+}
+
+template <typename T, size_t N>
+typename StaticRingBuffer<T, N>::Iterator& StaticRingBuffer<T, N>::Iterator::operator++() {
+    ++position;
+    return *this;
+}
+
+template <typename T, size_t N>
+bool StaticRingBuffer<T, N>::Iterator::operator!=(const Iterator& other) const {
+    return position != other.position;
+}
+
+template <typename T, size_t N>
+typename StaticRingBuffer<T, N>::Iterator StaticRingBuffer<T, N>::begin() const {
+    return Iterator(this, head);
+}
+
+template <typename T, size_t N>
+typename StaticRingBuffer<T, N>::Iterator StaticRingBuffer<T, N>::end() const {
+    return Iterator(this, tail);
+}
+
+#endif // STATICRINGBUFFER_CPP
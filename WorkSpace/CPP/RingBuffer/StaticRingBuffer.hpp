@@ -0,0 +1,71 @@
+#ifndef STATICRINGBUFFER_HPP
+#define STATICRINGBUFFER_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// 编译期容量的环形缓冲区
+// 元素直接存放在对象内部的 std::array 中，不做任何堆分配；
+// N 必须是 2 的幂，下标用掩码回绕，head/tail 为自由递增计数。
+template <typename T, size_t N>
+class StaticRingBuffer {
+    static_assert(N > 0 && std::has_single_bit(N),
+                  "StaticRingBuffer capacity must be a power of two");
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    std::array<T, N> buffer;
+    size_t head;  // 自由递增的读计数
+    size_t tail;  // 自由递增的写计数（元素个数 = tail - head）
+
+public:
+    // 构造函数
+    StaticRingBuffer() noexcept;
+    
+    // 核心操作（返回 bool）
+    bool push(const T& item);
+    bool push(T&& item);  // 右值引用版本
+    bool pop(T& item);
+    bool peek(T& item) const;
+    
+    // 现代 C++ 风格操作（返回 optional）
+    std::optional<T> pop();
+    std::optional<T> peek() const;
+    
+    // 状态查询
+    bool isEmpty() const noexcept;
+    bool isFull() const noexcept;
+    size_t size() const noexcept;
+    static constexpr size_t getCapacity() noexcept { return N; }
+    void clear() noexcept;
+    
+    // 批量操作
+    size_t pushMultiple(const T* items, size_t num);
+    size_t pushMultiple(const std::vector<T>& items);
+    size_t popMultiple(T* items, size_t num);
+    std::vector<T> popMultiple(size_t num);
+    
+    // 迭代器支持（只读）
+    class Iterator {
+    private:
+        const StaticRingBuffer* rb;
+        size_t position;  // 自由递增计数，解引用时再取掩码
+        
+    public:
+        Iterator(const StaticRingBuffer* buffer, size_t pos);
+        const T& operator*() const;
+        Iterator& operator++();
+        bool operator!=(const Iterator& other) const;
+    };
+    
+    Iterator begin() const;
+    Iterator end() const;
+};
+
+#include "StaticRingBuffer.cpp"
+
+#endif // STATICRINGBUFFER_HPP
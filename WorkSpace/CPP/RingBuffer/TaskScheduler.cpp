@@ -0,0 +1,191 @@
+#ifndef TASKSCHEDULER_CPP
+#define TASKSCHEDULER_CPP
+
+#include "TaskScheduler.hpp"
+#include <algorithm>
+#include <utility>
+
+// 非模板成员也随头文件一起包含，因此声明为 inline
+
+inline TaskScheduler::TaskScheduler(size_t threadCount)
+    : injection(4096), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // 先建好全部队列再启动线程，窃取时 workers 不会再变化
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+        workers.back()->rng = 0x9E3779B97F4A7C15ull * (i + 1);
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers[i]->thread = std::thread(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+inline TaskScheduler::~TaskScheduler() {
+    stopping.store(true, std::memory_order_release);
+    idle.notifyAll();
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+inline size_t TaskScheduler::getThreadCount() const noexcept {
+    return workers.size();
+}
+
+inline size_t TaskScheduler::selfIndex() const noexcept {
+    return currentScheduler == this ? currentIndex : NOT_A_WORKER;
+}
+
+inline void TaskScheduler::submit(Task* task) {
+    const size_t self = selfIndex();
+    if (self != NOT_A_WORKER) {
+        workers[self]->deque.push(task);
+    } else {
+        injection.push_wait(task);
+    }
+    idle.notify();
+}
+
+inline TaskScheduler::Task* TaskScheduler::findTask(size_t self) {
+    if (self != NOT_A_WORKER) {
+        if (auto task = workers[self]->deque.pop()) {
+            return *task;
+        }
+    }
+    if (auto task = injection.pop()) {
+        return *task;
+    }
+
+    // 随机挑选窃取对象（xorshift64），避免所有线程盯着同一个队列
+    static thread_local uint64_t externalRng = 0x2545F4914F6CDD1Dull;
+    uint64_t& rng = self != NOT_A_WORKER ? workers[self]->rng : externalRng;
+    const size_t n = workers.size();
+    for (size_t attempt = 0; attempt < 2 * n; ++attempt) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        const size_t victim = static_cast<size_t>(rng % n);
+        if (victim == self) {
+            continue;
+        }
+        if (auto task = workers[victim]->deque.steal()) {
+            return *task;
+        }
+    }
+    return nullptr;
+}
+
+inline void TaskScheduler::execute(Task* task) {
+    std::unique_ptr<Task> owned(task);
+    TaskGroup* group = owned->group;
+    try {
+        owned->fn();
+    } catch (...) {
+        group->recordError(std::current_exception());
+    }
+    // 先记录异常再减计数：计数归零后组可能立即被销毁
+    group->pending.fetch_sub(1, std::memory_order_release);
+}
+
+inline bool TaskScheduler::hasWork() const noexcept {
+    if (!injection.isEmpty()) {
+        return true;
+    }
+    return std::any_of(workers.begin(), workers.end(),
+                       [](const auto& worker) { return !worker->deque.isEmpty(); });
+}
+
+inline void TaskScheduler::workerLoop(size_t index) {
+    currentScheduler = this;
+    currentIndex = index;
+    for (;;) {
+        if (Task* task = findTask(index)) {
+            execute(task);
+            continue;
+        }
+        if (stopping.load(std::memory_order_acquire)) {
+            return;
+        }
+        idle.waitUntil([this] {
+            return stopping.load(std::memory_order_acquire) || hasWork();
+        });
+    }
+}
+
+template <typename F>
+void TaskScheduler::splitRange(TaskGroup& group, size_t begin, size_t end, size_t grain, const F& body) {
+    // 后一半作为任务交出去（可被窃取），前一半继续在本线程二分
+    while (end - begin > grain) {
+        const size_t mid = begin + (end - begin) / 2;
+        group.run([this, &group, mid, end, grain, &body] {
+            splitRange(group, mid, end, grain, body);
+        });
+        end = mid;
+    }
+    for (size_t i = begin; i < end; ++i) {
+        body(i);
+    }
+}
+
+template <typename F>
+void TaskScheduler::parallel_for(size_t begin, size_t end, size_t grain, F&& body) {
+    if (begin >= end) {
+        return;
+    }
+    TaskGroup group(*this);
+    splitRange(group, begin, end, std::max<size_t>(grain, 1), body);
+    group.wait();
+}
+
+// ---------------------------------------------------------------------------
+// TaskGroup
+// ---------------------------------------------------------------------------
+inline TaskScheduler::TaskGroup::TaskGroup(TaskScheduler& owner)
+    : scheduler(owner), pending(0) {}
+
+inline TaskScheduler::TaskGroup::~TaskGroup() {
+    waitAll();
+}
+
+template <typename F>
+void TaskScheduler::TaskGroup::run(F&& fn) {
+    // 先构造任务再计数：构造时抛出异常不会留下永远无法归零的计数
+    auto task = std::make_unique<Task>(Task{std::function<void()>(std::forward<F>(fn)), this});
+    pending.fetch_add(1, std::memory_order_relaxed);
+    scheduler.submit(task.release());
+}
+
+inline void TaskScheduler::TaskGroup::recordError(std::exception_ptr exception) noexcept {
+    std::lock_guard<std::mutex> lock(errorMutex);
+    if (!error) {
+        error = std::move(exception);
+    }
+}
+
+inline void TaskScheduler::TaskGroup::wait() {
+    waitAll();
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        exception = std::move(error);
+        error = nullptr;
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+inline void TaskScheduler::TaskGroup::waitAll() {
+    const size_t self = scheduler.selfIndex();
+    while (pending.load(std::memory_order_acquire) != 0) {
+        if (Task* task = scheduler.findTask(self)) {
+            scheduler.execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+#endif // TASKSCHEDULER_CPP
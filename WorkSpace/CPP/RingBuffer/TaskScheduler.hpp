@@ -0,0 +1,103 @@
+#ifndef TASKSCHEDULER_HPP
+#define TASKSCHEDULER_HPP
+
+#include "WorkStealingDeque.hpp"
+#include "MpmcRingBuffer.hpp"
+#include "WaitSignal.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 固定线程数的工作窃取任务调度器
+// 每个工作线程拥有一个 WorkStealingDeque：自己产生的任务压入本地底部并优先取回，
+// 空闲时随机挑选其他线程从顶部窃取；外部线程提交的任务进入共享的 MPMC 注入队列。
+class TaskScheduler {
+public:
+    class TaskGroup;
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr size_t NOT_A_WORKER = static_cast<size_t>(-1);
+
+    struct Task {
+        std::function<void()> fn;
+        TaskGroup* group;  // 所属任务组：完成时减少其未完成计数，异常记录到组内
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Worker {
+        WorkStealingDeque<Task*> deque;
+        std::thread thread;
+        uint64_t rng;  // 随机选择窃取对象
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    MpmcRingBuffer<Task*> injection;
+    WaitSignal idle;  // 空闲工作线程在此休眠
+    std::atomic<bool> stopping;
+
+    // 当前线程所属的调度器及其工作线程编号（外部线程为 nullptr / NOT_A_WORKER）
+    static inline thread_local TaskScheduler* currentScheduler = nullptr;
+    static inline thread_local size_t currentIndex = NOT_A_WORKER;
+
+    size_t selfIndex() const noexcept;
+    void submit(Task* task);
+    Task* findTask(size_t self);
+    void execute(Task* task);
+    bool hasWork() const noexcept;
+    void workerLoop(size_t index);
+
+    template <typename F>
+    void splitRange(TaskGroup& group, size_t begin, size_t end, size_t grain, const F& body);
+
+public:
+    // fork/join 任务组：run 派生子任务，wait 等待全部完成（等待期间帮忙执行其他任务）
+    // 任务抛出的异常不会结束工作线程：组内记录第一个异常，由 wait 重新抛出
+    class TaskGroup {
+    private:
+        TaskScheduler& scheduler;
+        std::atomic<size_t> pending;
+        std::mutex errorMutex;
+        std::exception_ptr error;  // 第一个失败任务的异常
+
+        friend class TaskScheduler;
+        void recordError(std::exception_ptr exception) noexcept;
+        void waitAll();  // 只等待，不抛出任务的异常
+
+    public:
+        explicit TaskGroup(TaskScheduler& owner);
+        // 析构时等待未完成的任务；尚未被 wait 取走的异常被丢弃
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template <typename F>
+        void run(F&& fn);
+        // 等待全部任务完成；有任务抛出异常时重新抛出第一个异常（随后清除）
+        void wait();
+    };
+
+    // 构造函数（threadCount 为 0 时使用硬件线程数）
+    explicit TaskScheduler(size_t threadCount = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // 对 [begin, end) 中每个下标调用 body(i)；区间递归二分到不超过 grain 后串行执行
+    // body 抛出异常时，等其余区间执行完后重新抛出第一个异常
+    template <typename F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F&& body);
+
+    size_t getThreadCount() const noexcept;
+};
+
+#include "TaskScheduler.cpp"
+
+#endif // TASKSCHEDULER_HPP
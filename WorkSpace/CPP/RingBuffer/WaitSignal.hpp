@@ -0,0 +1,133 @@
+#ifndef WAITSIGNAL_HPP
+#define WAITSIGNAL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 先自旋、后休眠的等待信号（供并发环形缓冲区的阻塞接口使用）
+// 等待方先短暂自旋，条件仍不满足再登记为等待者并休眠；
+// 通知方只在确实有等待者时才发起系统调用，无人等待时只有一次栅栏和一次读取。
+class WaitSignal {
+private:
+    static constexpr int SPIN_LIMIT = 128;
+    static constexpr int YIELD_LIMIT = 8;
+
+    std::atomic<uint32_t> epoch{0};    // 每次唤醒加一，休眠方据此判断是否错过通知
+    std::atomic<uint32_t> waiters{0};  // 当前登记的等待者数
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+                      std::atomic<uint32_t>::is_always_lock_free,
+                  "futex requires a plain 32-bit atomic");
+
+    static void cpuRelax() noexcept {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // 在 epoch 仍等于 expected 时休眠；超时返回 false
+    bool park(uint32_t expected, const std::chrono::steady_clock::time_point* deadline) {
+#if defined(__linux__)
+        timespec relative{};
+        if (deadline) {
+            const auto left = *deadline - std::chrono::steady_clock::now();
+            if (left <= std::chrono::steady_clock::duration::zero()) {
+                return false;
+            }
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(left).count();
+            relative.tv_sec = static_cast<time_t>(ns / 1000000000);
+            relative.tv_nsec = static_cast<long>(ns % 1000000000);
+        }
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE,
+                expected, deadline ? &relative : nullptr, nullptr, 0);
+        return !deadline || std::chrono::steady_clock::now() < *deadline;
+#else
+        if (!deadline) {
+            epoch.wait(expected, std::memory_order_acquire);
+            return true;
+        }
+        // 标准库的 atomic::wait 没有超时版本，退化为短睡眠轮询
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        return std::chrono::steady_clock::now() < *deadline;
+#endif
+    }
+
+    void wakeAll() noexcept {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE,
+                INT_MAX, nullptr, nullptr, 0);
+#else
+        epoch.notify_all();
+#endif
+    }
+
+public:
+    WaitSignal() = default;
+    WaitSignal(const WaitSignal&) = delete;
+    WaitSignal& operator=(const WaitSignal&) = delete;
+
+    // 状态改变（发布新下标）之后调用
+    void notify() noexcept {
+        // 与等待方的“登记后复查”配对，防止丢失唤醒
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) != 0) {
+            epoch.fetch_add(1, std::memory_order_release);
+            wakeAll();
+        }
+    }
+
+    // 等待 ready() 为真；deadline 为空表示无限等待，超时返回 false
+    template <typename Predicate>
+    bool waitUntil(Predicate ready, const std::chrono::steady_clock::time_point* deadline = nullptr) {
+        for (int i = 0; i < SPIN_LIMIT; ++i) {
+            if (ready()) {
+                return true;
+            }
+            cpuRelax();
+        }
+        for (int i = 0; i < YIELD_LIMIT; ++i) {
+            if (ready()) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+
+        for (;;) {
+            waiters.fetch_add(1, std::memory_order_seq_cst);
+            const uint32_t expected = epoch.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ready()) {
+                waiters.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            const bool inTime = park(expected, deadline);
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+            if (ready()) {
+                return true;
+            }
+            if (!inTime) {
+                return false;
+            }
+        }
+    }
+
+    // 唤醒所有等待者（关闭队列时使用）
+    void notifyAll() noexcept {
+        epoch.fetch_add(1, std::memory_order_release);
+        wakeAll();
+    }
+};
+
+#endif // WAITSIGNAL_HPP
@@ -0,0 +1,105 @@
+#ifndef WORKSTEALINGDEQUE_CPP
+#define WORKSTEALINGDEQUE_CPP
+
+#include "WorkStealingDeque.hpp"
+#include <bit>
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t initialCapacity)
+    : top(0), bottom(0), array(nullptr) {
+    if (initialCapacity == 0) {
+        throw std::invalid_argument("WorkStealingDeque capacity must be greater than 0");
+    }
+    arrays.push_back(std::make_unique<Array>(std::bit_ceil(initialCapacity)));
+    array.store(arrays.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::grow(Array* old, int64_t b, int64_t t) {
+    auto bigger = std::make_unique<Array>(old->capacity * 2);
+    for (int64_t i = t; i < b; ++i) {
+        bigger->put(i, old->get(i));
+    }
+    Array* raw = bigger.get();
+    arrays.push_back(std::move(bigger));
+    array.store(raw, std::memory_order_release);
+    return raw;
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T item) {
+    const int64_t b = bottom.load(std::memory_order_relaxed);
+    const int64_t t = top.load(std::memory_order_acquire);
+    Array* a = array.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(a->capacity) - 1) {
+        a = grow(a, b, t);
+    }
+    a->put(b, item);
+    // release 发布槽位内容（x86 上就是普通的 mov）
+    bottom.store(b + 1, std::memory_order_release);
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() {
+    const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    Array* a = array.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    // 先占住 bottom 再读 top，与窃取者的“先读 top 再读 bottom”构成 Dekker 式同步
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_release);  // 本来就是空的
+        return std::nullopt;
+    }
+
+    T item = a->get(b);
+    if (t == b) {
+        // 只剩最后一个元素：与窃取者抢 top
+        const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed);
+        // 所有者对 bottom 的每次写入都用 release，窃取者读到任何一次都能看到之前 push 的内容
+        bottom.store(b + 1, std::memory_order_release);
+        if (!won) {
+            return std::nullopt;
+        }
+    }
+    return item;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+        return std::nullopt;
+    }
+
+    Array* a = array.load(std::memory_order_acquire);
+    T item = a->get(t);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+        return std::nullopt;  // 被其他窃取者或所有者抢先
+    }
+    return item;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::isEmpty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::size() const noexcept {
+    const int64_t b = bottom.load(std::memory_order_acquire);
+    const int64_t t = top.load(std::memory_order_acquire);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::getCapacity() const noexcept {
+    return array.load(std::memory_order_acquire)->capacity;
+}
+
+#endif // WORKSTEALINGDEQUE_CPP
@@ -0,0 +1,76 @@
+#ifndef WORKSTEALINGDEQUE_HPP
+#define WORKSTEALINGDEQUE_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// Chase-Lev 工作窃取双端队列
+// 所有者线程在底部（bottom）无锁地 push/pop（后进先出，缓存友好）；
+// 其他线程从顶部（top）用一次 CAS 窃取（先进先出，偷走最大的任务）。
+// 下标沿用 RingBuffer 的做法：top/bottom 为自由递增计数，槽位用掩码取得。
+// 空间不足时所有者把数组扩容一倍，旧数组保留到队列析构，窃取者可能仍在读取。
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque stores elements in atomics (use pointers or handles)");
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct Array {
+        size_t capacity;
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Array(size_t size)
+            : capacity(size), mask(size - 1), slots(std::make_unique<std::atomic<T>[]>(size)) {}
+
+        T get(int64_t index) const noexcept {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+        void put(int64_t index, T value) noexcept {
+            slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    // 窃取者竞争的一端
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top;
+
+    // 所有者独占的一端
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom;
+    std::atomic<Array*> array;
+    std::vector<std::unique_ptr<Array>> arrays;  // 所有分配过的数组（只由所有者修改）
+
+    Array* grow(Array* old, int64_t b, int64_t t);
+
+public:
+    // 构造函数（初始容量向上取整为 2 的幂）
+    explicit WorkStealingDeque(size_t initialCapacity = 256);
+
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 所有者操作
+    void push(T item);
+    std::optional<T> pop();
+
+    // 任意线程：窃取最旧的元素；为空或与其他线程竞争失败时返回 nullopt
+    std::optional<T> steal();
+
+    // 状态查询（并发时为近似值）
+    bool isEmpty() const noexcept;
+    size_t size() const noexcept;
+    size_t getCapacity() const noexcept;
+};
+
+#include "WorkStealingDeque.cpp"
+
+#endif // WORKSTEALINGDEQUE_HPP
@@ -1,7 +1,36 @@
 #include "RingBuffer.hpp"
+#include "SpscRingBuffer.hpp"
+#include "MpmcRingBuffer.hpp"
+#include "StaticRingBuffer.hpp"
+#include "FlightRecorder.hpp"
+#include "ByteRingBuffer.hpp"
+#include "BroadcastRingBuffer.hpp"
+#include "AsyncRingBuffer.hpp"
+#include "WorkStealingDeque.hpp"
+#include "TaskScheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <numeric>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <cassert>
+#include <csignal>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include "ShmRingBuffer.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
@@ -256,25 +285,1181 @@ void testIterator() {
     cout << "✓ 迭代器工作正常" << endl;
 }
 
-void performanceTest() {
-    cout << "\n=== 性能测试 ===" << endl;
+void testBulkTransfer() {
+    cout << "\n=== 测试跨边界批量传输 ===" << endl;
+    
+    RingBuffer<int> rb(8);
+    int data[8];
+    for (int i = 0; i < 8; ++i) {
+        data[i] = i;
+    }
+    
+    // 让 head/tail 落在中间，后续批量操作必然跨越末尾
+    assert(rb.pushMultiple(data, 5) == 5);
+    int sink[8];
+    assert(rb.popMultiple(sink, 5) == 5);
+    assert(rb.pushMultiple(data, 8) == 8);
+    assert(rb.isFull());
+    assert(rb.pushMultiple(data, 1) == 0);
+    
+    assert(rb.popMultiple(sink, 8) == 8);
+    for (int i = 0; i < 8; ++i) {
+        assert(sink[i] == i);
+    }
+    cout << "✓ 平凡类型分两段 memcpy 传输正确" << endl;
+    
+    // 非平凡类型走移动区间
+    RingBuffer<string> srb(4);
+    srb.push("a");
+    srb.pop();
+    vector<string> words = {"w", "x", "y", "z", "overflow"};
+    assert(srb.pushMultiple(words) == 4);
+    
+    vector<string> out;
+    out.reserve(4);
+    const string* storage = out.data();
+    assert(srb.popMultiple(out, 3) == 3);
+    assert(out.data() == storage);  // 未重新分配
+    assert(out[0] == "w" && out[2] == "y");
+    assert(srb.popMultiple(out, 3) == 1);
+    assert(out.size() == 1 && out[0] == "z");
+    cout << "✓ 非平凡类型移动传输，复用调用方 vector 的容量" << endl;
+}
+
+void testZeroCopy() {
+    cout << "\n=== 测试零拷贝 reserve/commit 与 readable/consume ===" << endl;
+    
+    RingBuffer<int> rb(6);
+    rb.pushMultiple(vector<int>{0, 0, 0, 0});
+    rb.consume(4);  // 让写位置靠近末尾
+    
+    // 生产者直接写入槽位
+    auto spans = rb.reserve(5);
+    assert(spans.size() == 5);
+    assert(spans.first.size() == 2 && spans.second.size() == 3);
+    int next = 1;
+    for (int& slotRef : spans.first) {
+        slotRef = next++;
+    }
+    for (int& slotRef : spans.second) {
+        slotRef = next++;
+    }
+    assert(rb.isEmpty());  // 未 commit 前不可见
+    rb.commit(5);
+    assert(rb.size() == 5);
+    assert(rb.reserve(10).size() == 1);
+    
+    // 消费者原地读取
+    assert(rb.front() && *rb.front() == 1);
+    auto view = rb.readable();
+    assert(view.size() == 5);
+    int sum = 0;
+    for (int v : view.first) {
+        sum += v;
+    }
+    for (int v : view.second) {
+        sum += v;
+    }
+    assert(sum == 15);
+    rb.consume(3);
+    assert(rb.size() == 2 && *rb.front() == 4);
+    
+    bool threw = false;
+    try {
+        rb.consume(3);
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    rb.consume(2);
+    assert(rb.front() == nullptr && rb.readable().empty());
+    
+    cout << "✓ 跨边界的两段 span 读写正确，无需中间拷贝" << endl;
+}
+
+// 统计存活实例数的元素类型（故意不提供默认构造函数）
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+    
+    explicit Tracked(int v) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --alive; }
+};
+
+// 统计分配次数的分配器
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline size_t allocations = 0;
+    
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {}
+    
+    T* allocate(size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+    
+    bool operator==(const CountingAllocator&) const noexcept { return true; }
+};
+
+void testConsumeCallback() {
+    cout << "\n=== 测试回调式批量消费 ===" << endl;
     
-    const size_t BUFFER_SIZE = 1000;
-    const size_t OPERATIONS = 100000;
+    // 内容跨越缓冲区末尾时按两段依次回调
+    RingBuffer<string, allocator<string>, RingBufferStats> rb(4);
+    rb.push("a");
+    rb.push("b");
+    rb.pop();
+    rb.pop();
+    for (const char* s : {"w", "x", "y", "z"}) {
+        rb.push(s);
+    }
+    vector<string> seen;
+    assert(rb.consume_up_to(3, [&seen](string& s) { seen.push_back(std::move(s)); }) == 3);
+    assert((seen == vector<string>{"w", "x", "y"}));
+    assert(rb.size() == 1 && *rb.front() == "z");
+    assert(rb.consume_all([&seen](string& s) { seen.push_back(s); }) == 1);
+    assert(rb.isEmpty());
+    assert(rb.consume_all([](string&) { assert(false); }) == 0);
+    assert(rb.getStats().snapshot().pops == 6);
+    assert(rb.getStats().snapshot().failedPops == 1);
+    cout << "✓ consume_up_to / consume_all 按顺序原地处理并一次性推进 head" << endl;
+    
+    // 回调抛出异常：已处理的元素被取出，其余保留
+    RingBuffer<int> ints(8);
+    for (int i = 0; i < 5; ++i) {
+        ints.push(i);
+    }
+    try {
+        ints.consume_all([](int& v) {
+            if (v == 2) {
+                throw runtime_error("stop");
+            }
+        });
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+    assert(ints.size() == 3 && *ints.front() == 2);
+    cout << "✓ 回调异常时只移除已处理的元素" << endl;
+    
+    // SPSC：消费者整批回调，生产者并发写入
+    const int COUNT = 200000;
+    SpscRingBuffer<int> q(256);
+    thread producer([&q]() {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!q.push(i)) {
+                this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    while (expected < COUNT) {
+        if (q.consume_all([&expected](int& v) { assert(v == expected++); }) == 0) {
+            this_thread::yield();
+        }
+    }
+    producer.join();
+    assert(q.isEmpty());
+    cout << "✓ SPSC consume_all 跨线程按序取走 " << COUNT << " 个元素" << endl;
+}
+
+void testUninitializedStorage() {
+    cout << "\n=== 测试未初始化槽位存储 ===" << endl;
+    
+    {
+        RingBuffer<Tracked, CountingAllocator<Tracked>> rb(1000);
+        assert(Tracked::alive == 0);  // 构造时不创建任何元素
+        assert(CountingAllocator<Tracked>::allocations == 1);
+        
+        rb.push(Tracked(1));
+        rb.push(Tracked(2));
+        rb.push(Tracked(3));
+        assert(Tracked::alive == 3);
+        
+        auto item = rb.pop();
+        assert(item && item->value == 1);
+        assert(Tracked::alive == 3);  // 缓冲区 2 个 + item 1 个
+        item.reset();
+        assert(Tracked::alive == 2);  // 弹出的槽位已析构
+        
+        Tracked batch[] = {Tracked(4), Tracked(5)};
+        assert(rb.pushMultiple(batch, 2) == 2);
+        assert(Tracked::alive == 6);
+        
+        rb.clear();
+        assert(Tracked::alive == 2);  // 只剩 batch 数组本身
+        
+        rb.push(Tracked(6));
+        RingBuffer<Tracked, CountingAllocator<Tracked>> moved(std::move(rb));
+        assert(moved.size() == 1 && rb.getCapacity() == 0);
+    }
+    assert(Tracked::alive == 0);  // 析构只销毁活跃元素，没有泄漏
+    
+    RingBuffer<string> srb(4);
+    auto spans = srb.reserve(3);
+    spans.first[0] = "甲";
+    spans.first[1] = "乙";
+    srb.commit(2);  // 第三个预留槽位被析构回未初始化状态
+    assert(srb.size() == 2 && *srb.front() == "甲");
+    
+    cout << "✓ O(1) 构造，pop/clear 立即释放元素资源" << endl;
+}
+
+void testRandomAccessIterator() {
+    cout << "\n=== 测试随机访问迭代器与分段视图 ===" << endl;
+    
+    static_assert(random_access_iterator<RingBuffer<int>::iterator>);
+    static_assert(random_access_iterator<RingBuffer<int>::const_iterator>);
+    static_assert(is_same_v<decltype(*declval<const RingBuffer<int>&>().begin()), const int&>);
+    
+    // 让内容跨越回绕点
+    RingBuffer<int> rb(7);
+    rb.pushMultiple(vector<int>{0, 0, 0, 0, 0});
+    rb.consume(5);
+    for (int v : {10, 20, 30, 40, 50, 60}) {
+        rb.push(v);
+    }
+    assert(rb.segments().second.size() > 0);
+    
+    auto it = lower_bound(rb.begin(), rb.end(), 35);
+    assert(it - rb.begin() == 3 && *it == 40);
+    assert(rb.begin()[5] == 60 && *(rb.end() - 1) == 60);
+    assert(binary_search(rb.cbegin(), rb.cend(), 20));
+    
+    // 可写迭代器支持原地算法
+    reverse(rb.begin(), rb.end());
+    nth_element(rb.begin(), rb.begin() + 2, rb.end());
+    assert(rb.begin()[2] == 30);
+    sort(rb.begin(), rb.end());
+    assert(is_sorted(rb.cbegin(), rb.cend()));
+    
+    // 两段连续内存上的求和（可交给向量化或并行算法）
+    const auto& view = rb;
+    auto segs = view.segments();
+    int sum = reduce(segs.first.begin(), segs.first.end(), 0) +
+              reduce(segs.second.begin(), segs.second.end(), 0);
+    assert(sum == 210);
+    assert(reduce(rb.begin(), rb.end(), 0) == 210);
+    
+    cout << "✓ lower_bound / nth_element / sort / reduce 可直接作用于环形内容" << endl;
+}
+
+void testStatsPolicy() {
+    cout << "\n=== 测试统计策略 ===" << endl;
     
-    RingBuffer<int> rb(BUFFER_SIZE);
+    RingBuffer<int, std::allocator<int>, RingBufferStats> rb(8);
+    rb.getStats().enableDwellSampling(0);  // 每个元素都采样
     
-    // 交替 push 和 pop
-    for (size_t i = 0; i < OPERATIONS; ++i) {
+    int data[] = {1, 2, 3, 4, 5, 6};
+    rb.pushMultiple(data, 6);
+    rb.pushMultiple(data, 6);  // 只写入 2 个，拒绝 4 个
+    int value;
+    rb.pop(value);
+    rb.popMultiple(data, 3);
+    rb.setOverflowPolicy(OverflowPolicy::Overwrite);
+    for (int i = 0; i < 6; ++i) {
         rb.push(i);
-        if (i % 2 == 0) {
-            int value;
-            rb.pop(value);
+    }
+    rb.clear();
+    assert(!rb.pop().has_value());
+    
+    RingBufferStatsSnapshot snap = rb.getStats().snapshot();
+    assert(snap.capacity == 8);
+    assert(snap.pushes == 14);
+    assert(snap.pops == 4);
+    assert(snap.failedPushes == 4);
+    assert(snap.failedPops == 1);
+    assert(snap.dropped == 2);
+    assert(snap.highWaterMark == 8);
+    uint64_t occupancySamples = 0;
+    for (uint64_t c : snap.occupancy) {
+        occupancySamples += c;
+    }
+    assert(occupancySamples == 10);  // 每次成功的写入/读出调用记录一次
+    uint64_t dwellSamples = 0;
+    for (uint64_t c : snap.dwellNanos) {
+        dwellSamples += c;
+    }
+    assert(dwellSamples == 4);  // 被读出的 4 个元素都有停留时间
+    cout << "✓ 计数器、高水位、占用率与停留时间直方图正确" << endl;
+    
+    // 移动不分配内存：统计随缓冲区一起转移，停留时间采样继续有效
+    static_assert(is_nothrow_move_constructible_v<RingBufferStats>);
+    static_assert(is_nothrow_move_assignable_v<RingBufferStats>);
+    RingBuffer<int, std::allocator<int>, RingBufferStats> moved(std::move(rb));
+    assert(moved.getStats().snapshot().pushes == 14);
+    moved.push(1);
+    moved.pop(value);
+    snap = moved.getStats().snapshot();
+    assert(snap.pushes == 15 && snap.pops == 5);
+    dwellSamples = 0;
+    for (uint64_t c : snap.dwellNanos) {
+        dwellSamples += c;
+    }
+    assert(dwellSamples == 5);
+    rb = std::move(moved);  // 移动赋值经由 swap
+    assert(rb.getStats().snapshot().pops == 5);
+    cout << "✓ 统计对象随缓冲区 noexcept 移动" << endl;
+    
+    // 未启用统计时不占空间
+    static_assert(sizeof(RingBuffer<int>) < sizeof(RingBuffer<int, std::allocator<int>, RingBufferStats>));
+    cout << "✓ 默认策略零开销" << endl;
+}
+
+void testPowerOfTwoCapacity() {
+    cout << "\n=== 测试 2 的幂容量与编译期容量 ===" << endl;
+    
+    RingBuffer<int> rb(5, true);
+    assert(rb.getCapacity() == 8);  // 向上取整
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            assert(rb.push(round * 10 + i));
+        }
+        assert(rb.isFull() && !rb.push(-1));
+        for (int i = 0; i < 8; ++i) {
+            auto item = rb.pop();
+            assert(item && *item == round * 10 + i);
+        }
+        assert(rb.isEmpty());
+    }
+    cout << "✓ 掩码回绕的动态 RingBuffer 工作正常" << endl;
+    
+    StaticRingBuffer<int, 4> srb;
+    static_assert(StaticRingBuffer<int, 4>::getCapacity() == 4);
+    int data[] = {1, 2, 3, 4, 5};
+    assert(srb.pushMultiple(data, 5) == 4);
+    assert(srb.isFull());
+    int value;
+    assert(srb.pop(value) && value == 1);
+    assert(srb.push(5));
+    
+    int expected = 2;
+    for (const auto& item : srb) {
+        assert(item == expected++);
+    }
+    auto rest = srb.popMultiple(10);
+    assert(rest.size() == 4 && rest.front() == 2 && rest.back() == 5);
+    assert(srb.isEmpty() && !srb.peek().has_value());
+    cout << "✓ StaticRingBuffer 无堆分配，掩码回绕正确" << endl;
+}
+
+void testOverwriteMode() {
+    cout << "\n=== 测试覆盖模式（保留最新 N 个）===" << endl;
+    
+    RingBuffer<int> rb(4);
+    rb.setOverflowPolicy(OverflowPolicy::Overwrite);
+    for (int i = 1; i <= 10; ++i) {
+        assert(rb.push(i));  // 永远成功
+    }
+    assert(rb.isFull());
+    assert(rb.getDroppedCount() == 6);
+    
+    int expected = 7;
+    for (const auto& item : rb) {
+        assert(item == expected++);
+    }
+    assert(expected == 11);
+    
+    // 批量写入超过容量时只留下最后 capacity 个
+    int batch[] = {20, 21, 22, 23, 24, 25};
+    assert(rb.pushMultiple(batch, 6) == 4);
+    assert(rb.getDroppedCount() == 12);
+    auto items = rb.popMultiple(4);
+    assert(items.front() == 22 && items.back() == 25);
+    
+    rb.setOverflowPolicy(OverflowPolicy::Reject);
+    rb.pushMultiple(batch, 6);
+    assert(!rb.push(99));
+    cout << "✓ 溢出时 O(1) 丢弃最旧元素并计数" << endl;
+}
+
+struct Sample {
+    uint64_t sequence;
+    uint64_t check;  // sequence * 3，用于检测撕裂读
+};
+
+void testGrowMode() {
+    cout << "\n=== 测试自动扩容模式 ===" << endl;
+    
+    // 内容跨越末尾时扩容：元素按顺序排到新存储的起点
+    RingBuffer<string> rb(4, true);
+    rb.setOverflowPolicy(OverflowPolicy::Grow);
+    rb.setMaxCapacity(32);
+    for (int i = 0; i < 3; ++i) {
+        rb.push(to_string(i));
+    }
+    rb.pop();
+    rb.pop();
+    for (int i = 3; i < 20; ++i) {
+        assert(rb.push(to_string(i)));
+    }
+    assert(rb.getCapacity() == 32);
+    assert(rb.size() == 18);
+    auto segs = rb.segments();
+    assert(segs.second.empty() && segs.first.front() == "2");
+    int expected = 2;
+    for (const auto& item : rb) {
+        assert(item == to_string(expected++));
+    }
+    cout << "✓ 写满时按 2 倍扩容，扩容后内容线性排列" << endl;
+    
+    // 到达上限后拒绝写入
+    vector<string> more(20, "x");
+    assert(rb.pushMultiple(more) == 14);
+    assert(rb.isFull() && !rb.push("y"));
+    assert(rb.getCapacity() == 32);
+    cout << "✓ 只有达到 maxCapacity 后 push 才失败" << endl;
+    
+    // 突发结束后收缩，容量不低于构造时的大小
+    rb.popMultiple(29);
+    rb.shrink_to_fit();
+    assert(rb.getCapacity() == 4);
+    assert(rb.size() == 3 && *rb.front() == "x");
+    rb.clear();
+    rb.shrink_to_fit();
+    assert(rb.getCapacity() == 4);
+    cout << "✓ shrink_to_fit 收缩回构造容量" << endl;
+    
+    // 非 2 的幂容量与零拷贝 reserve 也会扩容
+    RingBuffer<int> odd(3);
+    odd.setOverflowPolicy(OverflowPolicy::Grow);
+    auto spans = odd.reserve(10);
+    assert(spans.size() == 10 && odd.getCapacity() == 12);
+    iota(spans.first.begin(), spans.first.end(), 0);
+    odd.commit(10);
+    int sum = 0;
+    odd.consume_all([&sum](int v) { sum += v; });
+    assert(sum == 45);
+    cout << "✓ reserve 在 Grow 模式下同样扩容" << endl;
+}
+
+void testFlightRecorder() {
+    cout << "\n=== 测试并发飞行记录仪快照 ===" << endl;
+    
+    FlightRecorder<Sample> recorder(64);
+    assert(recorder.snapshot().empty());
+    
+    const size_t SNAPSHOTS = 2000;
+    atomic<bool> stop{false};
+    atomic<uint64_t> pushed{0};
+    thread writer([&]() {
+        uint64_t i = 0;
+        while (!stop.load(memory_order_relaxed)) {
+            recorder.push(Sample{i, i * 3});
+            pushed.store(++i, memory_order_relaxed);
+            if (i % 256 == 0) {
+                this_thread::yield();  // 单核机器上也让读线程有机会插进来
+            }
+        }
+    });
+    
+    size_t snapshots = 0;
+    vector<Sample> snap;
+    while (snapshots < SNAPSHOTS) {
+        recorder.snapshot(snap);
+        for (size_t i = 0; i < snap.size(); ++i) {
+            assert(snap[i].check == snap[i].sequence * 3);  // 无撕裂
+            if (i > 0) {
+                assert(snap[i].sequence == snap[i - 1].sequence + 1);  // 连续
+            }
+        }
+        ++snapshots;
+    }
+    stop.store(true);
+    writer.join();
+    
+    const uint64_t total = pushed.load();
+    snap = recorder.snapshot();
+    assert(snap.size() == min<uint64_t>(total, 64));
+    assert(snap.empty() || snap.back().sequence == total - 1);
+    assert(recorder.getTotalPushed() == total);
+    cout << "✓ 写线程持续写入期间取得 " << snapshots << " 个一致快照" << endl;
+}
+
+void testByteRingBuffer() {
+    cout << "\n=== 测试镜像映射字节环 ===" << endl;
+    
+    ByteRingBuffer ring(100);
+    const size_t cap = ring.getCapacity();
+    assert(cap >= 100 && (cap & (cap - 1)) == 0);
+    cout << "  容量 " << cap << " 字节，镜像映射: " << (ring.isMirrored() ? "是" : "否（退化布局）") << endl;
+    
+    // 把读写位置推到末尾附近，让下一条消息跨越回绕点
+    string filler(cap - 5, 'x');
+    assert(ring.write(filler.data(), filler.size()) == filler.size());
+    ring.consume(filler.size());
+    
+    const string message = "HELLO|WORLD\n";
+    auto space = ring.writable();
+    if (ring.isMirrored()) {
+        assert(space.size() == cap);  // 可写区域整体连续
+    }
+    assert(ring.write(message.data(), message.size()) == message.size());
+    
+    string_view view = ring.readable();
+    if (ring.isMirrored()) {
+        // 一次调用即可处理跨越末尾的整条消息
+        assert(view == message);
+        const char* newline = static_cast<const char*>(memchr(view.data(), '\n', view.size()));
+        assert(newline && newline - view.data() == static_cast<ptrdiff_t>(message.size() - 1));
+    } else {
+        assert(view.size() == 5);  // 退化布局只给出第一段
+    }
+    
+    // 拷贝读在两种布局下都正确
+    char out[32] = {};
+    assert(ring.read(out, sizeof(out)) == message.size());
+    assert(string(out, message.size()) == message);
+    assert(ring.isEmpty());
+    cout << "✓ 跨越回绕点的消息读写正确" << endl;
+}
+
+#if defined(__linux__)
+void testShmRingBuffer() {
+    cout << "\n=== 测试共享内存跨进程队列 ===" << endl;
+    
+    const string name = "/rb_test_" + to_string(getpid());
+    ShmRingBuffer<uint64_t>::remove(name);
+    const uint64_t COUNT = 200000;
+    
+    // 子进程按名字附加为消费者，父进程作为生产者
+    {
+        auto producer = ShmRingBuffer<uint64_t>::create(name, 1000);
+        assert(producer.getCapacity() == 1024);
+        const pid_t child = fork();
+        assert(child >= 0);
+        if (child == 0) {
+            int code = 0;
+            try {
+                auto consumer = ShmRingBuffer<uint64_t>::attach(name);
+                uint64_t expected = 0;
+                while (expected < COUNT) {
+                    if (consumer.consume_all([&expected, &code](const uint64_t& v) {
+                            code |= v != expected++;
+                        }) == 0) {
+                        this_thread::yield();
+                    }
+                }
+            } catch (...) {
+                code = 2;
+            }
+            _exit(code);
+        }
+        for (uint64_t i = 0; i < COUNT; ++i) {
+            while (!producer.push(i)) {
+                this_thread::yield();
+            }
         }
+        int status = 0;
+        waitpid(child, &status, 0);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        assert(producer.isEmpty());
     }
+    cout << "✓ 两个进程经共享内存按序传递 " << COUNT << " 个元素" << endl;
     
-    cout << "✓ 完成 " << OPERATIONS << " 次操作" << endl;
-    cout << "  最终缓冲区大小: " << rb.size() << endl;
+    // 生产者进程写到一半被杀死：已发布的数据保留，未 commit 的槽位不可见
+    const pid_t writer = fork();
+    assert(writer >= 0);
+    if (writer == 0) {
+        auto producer = ShmRingBuffer<uint64_t>::create(name, 1024);
+        for (uint64_t i = 0; i < 100; ++i) {
+            producer.push(1000 + i);
+        }
+        auto spans = producer.reserve(10);
+        fill(spans.first.begin(), spans.first.end(), 0xDEAD);
+        fill(spans.second.begin(), spans.second.end(), 0xDEAD);
+        raise(SIGKILL);  // 析构函数不会运行，头部里仍登记着已退出的进程号
+    }
+    int status = 0;
+    waitpid(writer, &status, 0);
+    assert(WIFSIGNALED(status));
+    
+    auto consumer = ShmRingBuffer<uint64_t>::attach(name);
+    assert(!consumer.isPeerAlive());
+    assert(consumer.size() == 100);
+    uint64_t expected = 1000;
+    consumer.consume_all([&expected](const uint64_t& v) { assert(v == expected++); });
+    assert(expected == 1100);
+    
+    // 新的生产者接管，之后的写入正常送达
+    auto producer = ShmRingBuffer<uint64_t>::create(name, 1024);
+    assert(consumer.isPeerAlive());
+    bool rejected = false;
+    try {
+        ShmRingBuffer<uint64_t>::create(name, 1024);
+    } catch (const runtime_error&) {
+        rejected = true;  // 同一时间只能有一个存活的生产者
+    }
+    assert(rejected);
+    producer.push(7);
+    assert(consumer.pop() == 7u);
+    assert(consumer.isEmpty());
+    assert(ShmRingBuffer<uint64_t>::remove(name));
+    cout << "✓ 生产者崩溃后只保留已发布的元素，新进程可以接管" << endl;
+    
+    // 创建者在 shm_open 之后、发布 magic 之前被杀死：分别停在 ftruncate 之前和之后
+    for (const bool truncated : {false, true}) {
+        const pid_t creator = fork();
+        assert(creator >= 0);
+        if (creator == 0) {
+            const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0 || (truncated && ftruncate(fd, 1 << 16) != 0)) {
+                _exit(1);
+            }
+            raise(SIGKILL);
+        }
+        status = 0;
+        waitpid(creator, &status, 0);
+        assert(WIFSIGNALED(status));
+        
+        if (!truncated) {
+            // 消费者无法区分“正在初始化”与“已遗弃”，等待超时后报错
+            bool uninitialized = false;
+            try {
+                ShmRingBuffer<uint64_t>::attach(name);
+            } catch (const runtime_error&) {
+                uninitialized = true;
+            }
+            assert(uninitialized);
+        }
+        // 生产者等待超时后删除遗弃的段并重新创建
+        auto recovered = ShmRingBuffer<uint64_t>::create(name, 64);
+        assert(recovered.getCapacity() == 64);
+        auto reader = ShmRingBuffer<uint64_t>::attach(name);
+        assert(recovered.push(42));
+        assert(reader.pop() == 42u);
+        assert(ShmRingBuffer<uint64_t>::remove(name));
+    }
+    cout << "✓ 创建者初始化前崩溃留下的段会被新的生产者删除重建" << endl;
+}
+#endif // __linux__
+
+// 统计拷贝次数的元素类型
+struct Counted {
+    static inline int copies = 0;
+    int value = 0;
+    
+    Counted() = default;
+    explicit Counted(int v) : value(v) {}
+    Counted(const Counted& other) : value(other.value) { ++copies; }
+    Counted(Counted&&) noexcept = default;
+    Counted& operator=(const Counted& other) { value = other.value; ++copies; return *this; }
+    Counted& operator=(Counted&&) noexcept = default;
+};
+
+void testBroadcastRingBuffer() {
+    cout << "\n=== 测试广播环形缓冲区 ===" << endl;
+    
+    // 每个消费者都能读到全部元素，且读取不产生拷贝
+    BroadcastRingBuffer<Counted> rb(4);
+    const size_t logger = rb.addConsumer();
+    const size_t metrics = rb.addConsumer();
+    const size_t processor = rb.addConsumer({logger, metrics});
+    assert(rb.getConsumerCount() == 3);
+    
+    for (int i = 0; i < 4; ++i) {
+        assert(rb.push(Counted(i)));
+    }
+    assert(!rb.push(Counted(4)));  // 最慢的消费者还没读
+    assert(Counted::copies == 0);  // 右值写入是移动赋值
+    
+    assert(rb.available(processor) == 0);  // 依赖的消费者尚未处理
+    int sum = 0;
+    assert(rb.consume(logger, [&sum](const Counted& c) { sum += c.value; }) == 4);
+    assert(rb.available(processor) == 0);
+    assert(rb.consume_up_to(metrics, 2, [&sum](const Counted& c) { sum += c.value; }) == 2);
+    assert(rb.available(processor) == 2);
+    assert(!rb.push(Counted(4)));  // processor 仍是最慢的末端消费者
+    assert(rb.consume(processor, [&sum](const Counted& c) { sum += c.value; }) == 2);
+    assert(rb.push(Counted(4)));
+    assert(sum == 6 + 1 + 1);
+    assert(Counted::copies == 0);
+    cout << "✓ 多个消费者原地读取同一元素，生产者只等待末端消费者" << endl;
+    
+    // 并发：两个独立消费者 + 一个依赖它们的消费者，全部按序看到每个元素
+    const uint64_t COUNT = 200000;
+    BroadcastRingBuffer<uint64_t> stream(256);
+    const size_t a = stream.addConsumer();
+    const size_t b = stream.addConsumer();
+    const size_t c = stream.addConsumer({a, b});
+    vector<thread> consumers;
+    vector<uint64_t> sums(3, 0);
+    for (size_t id : {a, b, c}) {
+        consumers.emplace_back([&stream, &sums, id]() {
+            uint64_t expected = 0;
+            while (expected < COUNT) {
+                const size_t n = stream.consume(id, [&expected, &sums, id](const uint64_t& v) {
+                    assert(v == expected++);
+                    sums[id] += v;
+                });
+                if (n == 0) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    vector<uint64_t> batch(32);
+    for (uint64_t i = 0; i < COUNT;) {
+        const size_t want = static_cast<size_t>(min<uint64_t>(batch.size(), COUNT - i));
+        iota(batch.begin(), batch.begin() + static_cast<ptrdiff_t>(want), i);
+        const size_t n = stream.pushMultiple(batch.data(), want);
+        if (n == 0) {
+            this_thread::yield();
+        }
+        i += n;
+    }
+    for (auto& t : consumers) {
+        t.join();
+    }
+    for (uint64_t total : sums) {
+        assert(total == COUNT * (COUNT - 1) / 2);
+    }
+    assert(stream.getPublishedCount() == COUNT);
+    cout << "✓ 3 个消费者（含依赖关系）各自按序收到 " << COUNT << " 个元素" << endl;
+}
+
+AsyncTask asyncProducer(AsyncRingBuffer<int>& ring, int first, int count) {
+    for (int i = 0; i < count; ++i) {
+        co_await ring.async_push(first + i);
+    }
+}
+
+AsyncTask asyncConsumer(AsyncRingBuffer<int>& ring, int count, long long& sum, int& done) {
+    for (int i = 0; i < count; ++i) {
+        sum += co_await ring.async_pop();
+    }
+    ++done;
+}
+
+AsyncTask asyncOrderedConsumer(AsyncRingBuffer<int>& ring, int count, bool& ordered) {
+    for (int i = 0; i < count; ++i) {
+        ordered = ordered && (co_await ring.async_pop()) == i;
+    }
+}
+
+void testCoroutineAwait() {
+    cout << "\n=== 测试协程 async_push / async_pop ===" << endl;
+    
+    // 消费者先启动并挂起，生产者写满后也挂起，双方交替唤醒
+    CoroutineExecutor executor;
+    AsyncRingBuffer<int> ring(4, executor);
+    bool ordered = true;
+    asyncOrderedConsumer(ring, 100, ordered).start(executor);
+    executor.run();
+    assert(ring.waitingPoppers() == 1);
+    asyncProducer(ring, 0, 100).start(executor);
+    executor.run();
+    assert(ordered);
+    assert(ring.isEmpty() && ring.waitingPoppers() == 0 && ring.waitingPushers() == 0);
+    cout << "✓ 空/满时挂起，对方改变状态后按 FIFO 恢复" << endl;
+    
+    // 单线程上运行 10000 个生产者/消费者协程
+    const int PAIRS = 5000;
+    const int ITEMS = 20;
+    AsyncRingBuffer<int> shared(8, executor);
+    long long sum = 0;
+    int done = 0;
+    for (int p = 0; p < PAIRS; ++p) {
+        asyncConsumer(shared, ITEMS, sum, done).start(executor);
+        asyncProducer(shared, p * ITEMS, ITEMS).start(executor);
+    }
+    const size_t resumed = executor.run();
+    const long long total = static_cast<long long>(PAIRS) * ITEMS;
+    assert(done == PAIRS);
+    assert(sum == total * (total - 1) / 2);
+    assert(shared.isEmpty() && shared.waitingPushers() == 0);
+    cout << "✓ 单线程调度 " << 2 * PAIRS << " 个协程，恢复 " << resumed
+         << " 次，" << total << " 个元素全部送达" << endl;
+    
+    // 非阻塞接口同样会唤醒等待者
+    asyncOrderedConsumer(ring, 1, ordered).start(executor);
+    executor.run();
+    assert(ring.try_push(0));
+    assert(ring.isEmpty());  // 直接交给了等待中的消费者
+    executor.run();
+    assert(ordered && ring.waitingPoppers() == 0);
+    cout << "✓ try_push 直接把元素交给挂起的消费者" << endl;
+}
+
+void testSpscBasic() {
+    cout << "\n=== 测试 SPSC 无锁缓冲区 ===" << endl;
+    
+    SpscRingBuffer<int> rb(3);
+    assert(rb.isEmpty());
+    assert(rb.getCapacity() == 3);
+    
+    assert(rb.push(1));
+    assert(rb.push(2));
+    assert(rb.push(3));
+    assert(rb.isFull());
+    assert(!rb.push(4));
+    
+    int value;
+    assert(rb.peek(value) && value == 1);
+    assert(rb.pop(value) && value == 1);
+    assert(rb.push(4));  // 跨越环形边界
+    
+    int out[3];
+    assert(rb.popMultiple(out, 3) == 3);
+    assert(out[0] == 2 && out[1] == 3 && out[2] == 4);
+    assert(!rb.pop().has_value());
+    
+    vector<int> data = {5, 6, 7, 8};
+    assert(rb.pushMultiple(data) == 3);
+    auto popped = rb.popMultiple(10);
+    assert(popped.size() == 3 && popped[0] == 5 && popped[2] == 7);
+    
+    cout << "✓ SPSC 单线程语义与 RingBuffer 一致" << endl;
+}
+
+void testSpscThreads() {
+    cout << "\n=== 测试 SPSC 跨线程传递 ===" << endl;
+    
+    const int COUNT = 1000000;
+    SpscRingBuffer<int> rb(1024);
+    
+    thread producer([&rb]() {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!rb.push(i)) {
+                this_thread::yield();
+            }
+        }
+    });
+    
+    long long sum = 0;
+    int expected = 0;
+    while (expected < COUNT) {
+        auto item = rb.pop();
+        if (!item) {
+            this_thread::yield();
+            continue;
+        }
+        assert(*item == expected);  // 顺序必须保持
+        sum += *item;
+        ++expected;
+    }
+    producer.join();
+    
+    assert(sum == static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+    assert(rb.isEmpty());
+    cout << "✓ 生产者/消费者线程传递 " << COUNT << " 个元素，顺序正确" << endl;
+}
+
+void testMpmcBasic() {
+    cout << "\n=== 测试 MPMC 队列基本操作 ===" << endl;
+    
+    MpmcRingBuffer<string> q(3);
+    assert(q.getCapacity() == 4);  // 向上取整为 2 的幂
+    assert(q.isEmpty());
+    
+    for (int i = 0; i < 4; ++i) {
+        assert(q.push(to_string(i)));
+    }
+    assert(q.isFull());
+    assert(!q.push(string("溢出")));
+    
+    string value;
+    assert(q.pop(value) && value == "0");
+    assert(q.push(string("4")));  // 第二轮复用槽位
+    for (int i = 1; i <= 4; ++i) {
+        auto item = q.pop();
+        assert(item && *item == to_string(i));
+    }
+    assert(!q.pop().has_value());
+    
+    cout << "✓ MPMC 单线程 FIFO 语义正确" << endl;
+}
+
+void testMpmcStress() {
+    cout << "\n=== MPMC 压力测试（1~64 线程）===" << endl;
+    
+    constexpr size_t ITEMS_PER_PRODUCER = 20000;
+    const pair<size_t, size_t> configs[] = {
+        {1, 1}, {1, 3}, {3, 1}, {2, 2}, {4, 4}, {8, 8}, {16, 16}, {32, 32}
+    };
+    
+    for (const auto& [producers, consumers] : configs) {
+        MpmcRingBuffer<size_t> q(64);
+        const size_t total = producers * ITEMS_PER_PRODUCER;
+        vector<atomic<unsigned char>> seen(total);
+        atomic<size_t> consumed{0};
+        vector<thread> threads;
+        
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&q, p]() {
+                for (size_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                    size_t item = p * ITEMS_PER_PRODUCER + i;
+                    while (!q.push(std::move(item))) {
+                        this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (size_t c = 0; c < consumers; ++c) {
+            threads.emplace_back([&q, &seen, &consumed, total]() {
+                while (consumed.load(memory_order_relaxed) < total) {
+                    auto item = q.pop();
+                    if (!item) {
+                        this_thread::yield();
+                        continue;
+                    }
+                    assert(*item < total);
+                    // 每个元素必须恰好被消费一次
+                    assert(seen[*item].fetch_add(1, memory_order_relaxed) == 0);
+                    consumed.fetch_add(1, memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        
+        assert(consumed.load() == total);
+        for (size_t i = 0; i < total; ++i) {
+            assert(seen[i].load() == 1);
+        }
+        assert(q.isEmpty());
+        cout << "✓ " << producers << " 生产者 / " << consumers << " 消费者: "
+             << total << " 个元素恰好各到达一次" << endl;
+    }
+}
+
+void testBlockingWait() {
+    cout << "\n=== 测试阻塞 push/pop 与 close ===" << endl;
+    
+    // 空队列上的超时等待
+    SpscRingBuffer<int> rb(8);
+    auto start = chrono::steady_clock::now();
+    assert(!rb.pop_for(chrono::milliseconds(20)).has_value());
+    assert(chrono::steady_clock::now() - start >= chrono::milliseconds(20));
+    cout << "✓ pop_for 超时返回 nullopt" << endl;
+    
+    // 小容量迫使双方都进入休眠
+    const int COUNT = 100000;
+    thread producer([&rb]() {
+        for (int i = 0; i < COUNT; ++i) {
+            assert(rb.push_wait(i));
+        }
+        rb.close();
+    });
+    
+    long long sum = 0;
+    int received = 0;
+    int batch[16];
+    while (size_t n = rb.pop_wait_multiple(batch, 16)) {
+        for (size_t i = 0; i < n; ++i) {
+            assert(batch[i] == received++);
+            sum += batch[i];
+        }
+    }
+    producer.join();
+    assert(received == COUNT);
+    assert(sum == static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+    assert(!rb.push_wait(1));  // 关闭后拒绝写入
+    cout << "✓ SPSC 阻塞传递 " << COUNT << " 个元素，关闭后消费者取空退出" << endl;
+    
+    // MPMC：多个消费者阻塞等待，关闭后全部退出
+    MpmcRingBuffer<int> q(16);
+    atomic<long long> total{0};
+    vector<thread> consumers;
+    for (int c = 0; c < 4; ++c) {
+        consumers.emplace_back([&q, &total]() {
+            while (auto item = q.pop_wait()) {
+                total.fetch_add(*item, memory_order_relaxed);
+            }
+        });
+    }
+    for (int i = 1; i <= 10000; ++i) {
+        assert(q.push_wait(i));
+    }
+    q.close();
+    for (auto& t : consumers) {
+        t.join();
+    }
+    assert(total.load() == 10000LL * 10001 / 2);
+    cout << "✓ MPMC 消费者在 close 后取完剩余元素并退出" << endl;
+}
+
+void testWorkStealingDeque() {
+    cout << "\n=== 测试工作窃取双端队列 ===" << endl;
+    
+    // 所有者后进先出，窃取者先进先出；超过初始容量时自动扩容
+    WorkStealingDeque<int> dq(4);
+    for (int i = 0; i < 10; ++i) {
+        dq.push(i);
+    }
+    assert(dq.size() == 10);
+    assert(dq.getCapacity() >= 10);
+    assert(dq.steal() == 0);
+    assert(dq.steal() == 1);
+    assert(dq.pop() == 9);
+    assert(dq.pop() == 8);
+    assert(dq.size() == 6);
+    while (dq.pop()) {
+    }
+    assert(dq.isEmpty());
+    assert(!dq.steal().has_value());
+    cout << "✓ 所有者 LIFO、窃取者 FIFO，扩容后内容不变" << endl;
+    
+    // 所有者边压入边弹出，多个窃取者同时窃取：每个元素恰好被取走一次
+    constexpr size_t TOTAL = 200000;
+    constexpr size_t THIEVES = 3;
+    WorkStealingDeque<uint32_t> shared(8);
+    vector<atomic<unsigned char>> seen(TOTAL);
+    atomic<size_t> taken{0};
+    atomic<bool> done{false};
+    
+    auto take = [&seen, &taken](uint32_t item) {
+        assert(item < TOTAL);
+        assert(seen[item].fetch_add(1, memory_order_relaxed) == 0);
+        taken.fetch_add(1, memory_order_relaxed);
+    };
+    vector<thread> thieves;
+    for (size_t t = 0; t < THIEVES; ++t) {
+        thieves.emplace_back([&shared, &done, &take]() {
+            while (!done.load(memory_order_acquire) || !shared.isEmpty()) {
+                if (auto item = shared.steal()) {
+                    take(*item);
+                } else {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+    for (uint32_t i = 0; i < TOTAL; ++i) {
+        shared.push(i);
+        if (i % 3 == 0) {
+            if (auto item = shared.pop()) {
+                take(*item);
+            }
+        }
+    }
+    while (auto item = shared.pop()) {
+        take(*item);
+    }
+    done.store(true, memory_order_release);
+    for (auto& t : thieves) {
+        t.join();
+    }
+    assert(taken.load() == TOTAL);
+    cout << "✓ 1 个所有者 + " << THIEVES << " 个窃取者: " << TOTAL << " 个元素恰好各取走一次" << endl;
+}
+
+static uint64_t fibSerial(unsigned n) {
+    return n < 2 ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+static uint64_t fibParallel(TaskScheduler& scheduler, unsigned n) {
+    if (n < 12) {
+        return fibSerial(n);
+    }
+    uint64_t left = 0;
+    TaskScheduler::TaskGroup group(scheduler);
+    group.run([&scheduler, &left, n]() { left = fibParallel(scheduler, n - 1); });
+    const uint64_t right = fibParallel(scheduler, n - 2);
+    group.wait();
+    return left + right;
+}
+
+void testTaskScheduler() {
+    cout << "\n=== 测试任务调度器 ===" << endl;
+    
+    TaskScheduler scheduler(4);
+    assert(scheduler.getThreadCount() == 4);
+    
+    // parallel_for：每个下标恰好执行一次
+    constexpr size_t N = 100000;
+    vector<atomic<unsigned char>> visited(N);
+    atomic<uint64_t> sum{0};
+    scheduler.parallel_for(0, N, 256, [&visited, &sum](size_t i) {
+        assert(visited[i].fetch_add(1, memory_order_relaxed) == 0);
+        sum.fetch_add(i, memory_order_relaxed);
+    });
+    assert(sum.load() == static_cast<uint64_t>(N) * (N - 1) / 2);
+    scheduler.parallel_for(5, 5, 1, [](size_t) { assert(false); });
+    cout << "✓ parallel_for 覆盖 [0, " << N << ") 每个下标恰好一次" << endl;
+    
+    // 递归 fork/join：子任务在工作线程里继续派生，wait 期间帮忙执行
+    assert(fibParallel(scheduler, 27) == fibSerial(27));
+    cout << "✓ 递归 fork/join 计算 fib(27) = " << fibSerial(27) << endl;
+    
+    // 外部线程多次提交任务组
+    for (int round = 0; round < 50; ++round) {
+        atomic<int> count{0};
+        TaskScheduler::TaskGroup group(scheduler);
+        for (int i = 0; i < 100; ++i) {
+            group.run([&count]() { count.fetch_add(1, memory_order_relaxed); });
+        }
+        group.wait();
+        assert(count.load() == 100);
+    }
+    cout << "✓ 外部线程经注入队列提交 50 轮任务组" << endl;
+    
+    // 任务抛出异常：其余任务照常完成，wait 重新抛出第一个异常，工作线程继续可用
+    {
+        atomic<int> count{0};
+        TaskScheduler::TaskGroup group(scheduler);
+        for (int i = 0; i < 100; ++i) {
+            group.run([&count, i]() {
+                if (i % 10 == 3) {
+                    throw runtime_error("task failed");
+                }
+                count.fetch_add(1, memory_order_relaxed);
+            });
+        }
+        bool caught = false;
+        try {
+            group.wait();
+        } catch (const runtime_error& e) {
+            caught = string(e.what()) == "task failed";
+        }
+        assert(caught);
+        assert(count.load() == 90);
+        group.wait();  // 异常已被取走，不会再次抛出
+    }
+    {
+        // 子任务在工作线程的 wait 中抛出：异常沿外层任务传回外层组
+        TaskScheduler::TaskGroup outer(scheduler);
+        outer.run([&scheduler]() {
+            TaskScheduler::TaskGroup inner(scheduler);
+            inner.run([]() { throw logic_error("nested"); });
+            inner.wait();
+        });
+        bool caught = false;
+        try {
+            outer.wait();
+        } catch (const logic_error&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+    {
+        bool caught = false;
+        try {
+            scheduler.parallel_for(0, 10000, 16, [](size_t i) {
+                if (i == 7777) {
+                    throw out_of_range("index");
+                }
+            });
+        } catch (const out_of_range&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+    {
+        // 未被 wait 取走的异常在析构时丢弃
+        TaskScheduler::TaskGroup group(scheduler);
+        group.run([]() { throw runtime_error("dropped"); });
+    }
+    assert(fibParallel(scheduler, 20) == fibSerial(20));
+    cout << "✓ 任务异常由 wait 重新抛出，调度器继续可用" << endl;
 }
 
 int main() {
@@ -293,7 +1478,29 @@ int main() {
         testOptionalAPI();
         testVectorAPI();
         testIterator();
-        performanceTest();
+        testBulkTransfer();
+        testZeroCopy();
+        testConsumeCallback();
+        testUninitializedStorage();
+        testRandomAccessIterator();
+        testStatsPolicy();
+        testPowerOfTwoCapacity();
+        testOverwriteMode();
+        testGrowMode();
+        testFlightRecorder();
+        testByteRingBuffer();
+#if defined(__linux__)
+        testShmRingBuffer();
+#endif
+        testBroadcastRingBuffer();
+        testCoroutineAwait();
+        testSpscBasic();
+        testSpscThreads();
+        testMpmcBasic();
+        testMpmcStress();
+        testBlockingWait();
+        testWorkStealingDeque();
+        testTaskScheduler();
         
         cout << "\n========================================" << endl;
         cout << "         所有测试通过！✓✓✓" << endl;